@@ -343,6 +343,42 @@ namespace alize
     ///
     real_t getParam_sampleRate() const;
 
+    /// @exception if the param does not exist
+    ///
+    bool getParam_computeLLKInLogDomain() const;
+
+    /// @exception if the param does not exist
+    ///
+    unsigned long getParam_topDistribsTreeClusterCount() const;
+
+    /// @exception if the param does not exist
+    ///
+    unsigned long getParam_topDistribsTreeBeam() const;
+
+    /// @exception if the param does not exist
+    ///
+    unsigned long getParam_numThread() const;
+
+    /// @exception if the param does not exist
+    ///
+    bool getParam_threadPinning() const;
+
+    /// @exception if the param does not exist
+    ///
+    bool getParam_loadFeatureFileReadAhead() const;
+
+    /// @exception if the param does not exist
+    ///
+    bool getParam_loadFeatureFileMemoryMap() const;
+
+    /// @exception if the param does not exist
+    ///
+    FeatureFileCompression getParam_saveFeatureFileCompression() const;
+
+    /// @exception if the param does not exist
+    ///
+    bool getParam_saveFeatureFileBackgroundFlush() const;
+
     virtual String getClassName() const;
     virtual String toString() const;
 
@@ -389,6 +425,15 @@ namespace alize
     bool  existsParam_audioFilesPath;
     bool  existsParam_segServerFilesPath;
     bool  existsParam_mixtureFilesPath;
+    bool  existsParam_computeLLKInLogDomain;
+    bool  existsParam_topDistribsTreeClusterCount;
+    bool  existsParam_topDistribsTreeBeam;
+    bool  existsParam_numThread;
+    bool  existsParam_threadPinning;
+    bool  existsParam_loadFeatureFileReadAhead;
+    bool  existsParam_loadFeatureFileMemoryMap;
+    bool  existsParam_saveFeatureFileCompression;
+    bool  existsParam_saveFeatureFileBackgroundFlush;
 
   private :
     real_t              _param_minCov;
@@ -434,6 +479,15 @@ namespace alize
     DistribType  _param_distribType;
     bool         _param_bigEndian;
     real_t       _param_sampleRate;
+    bool         _param_computeLLKInLogDomain;
+    unsigned long _param_topDistribsTreeClusterCount;
+    unsigned long _param_topDistribsTreeBeam;
+    unsigned long _param_numThread;
+    bool         _param_threadPinning;
+    bool         _param_loadFeatureFileReadAhead;
+    bool         _param_loadFeatureFileMemoryMap;
+    FeatureFileCompression _param_saveFeatureFileCompression;
+    bool         _param_saveFeatureFileBackgroundFlush;
 
     XList        _set;
 
@@ -104,14 +104,11 @@ namespace alize
 
   private :
 
-    unsigned long _line;
-
     String    _paramName;
     bool      _paramNameDefined;
     
     Config* _pConfig;
 
-    virtual const String& readOneChar();
     virtual void eventOpeningElement(const String& path);
     virtual void eventClosingElement(const String& path,
                      const String& value);
@@ -71,6 +71,7 @@
 namespace alize
 {
   class Feature;
+  class FeatureBlock;
 
   /// Abstract base class for all distribution classes.
   ///
@@ -164,6 +165,49 @@ namespace alize
     virtual lk_t computeLK(const Feature&) const = 0;
     virtual lk_t computeLK(const Feature&, unsigned long idx) const = 0;
 
+    /// Computes the likelihood between this distribution and a range of
+    /// features of a block, multiplies it by a weight and adds the result
+    /// to an array : lkVect[i] += w * computeLK(feature i).\n
+    /// The default implementation copies each feature of the block and
+    /// calls computeLK(). Derived classes can override it with a faster
+    /// implementation.
+    /// @param b the block of features
+    /// @param first index of the first feature to use in the block
+    /// @param count number of features to use
+    /// @param w the weight
+    /// @param lkVect the array. Index i corresponds to the feature i of
+    ///      the block
+    /// @exception Exception if the block vectSize does not match the
+    ///      distribution vectSize
+    ///
+    virtual void computeAndAccumulateLK(const FeatureBlock& b,
+                 unsigned long first, unsigned long count, weight_t w,
+                 lk_t* lkVect) const;
+
+    /// Computes the logarithm of the likelihood between this distribution
+    /// and a Feature object. Unlike log(computeLK()), the result does not
+    /// underflow when the feature is far from the mean.\n
+    /// The default implementation returns log(computeLK()).
+    /// @return the log-likelihood
+    ///
+    virtual lk_t computeLogLK(const Feature&) const;
+
+    /// Computes the log-likelihood between this distribution and a range
+    /// of features of a block : logLkVect[i] = computeLogLK(feature
+    /// first+i).\n
+    /// The default implementation copies each feature of the block and
+    /// calls computeLogLK().
+    /// @param b the block of features
+    /// @param first index of the first feature to use in the block
+    /// @param count number of features to use
+    /// @param logLkVect the array to fill (count values)
+    /// @exception Exception if the block vectSize does not match the
+    ///      distribution vectSize
+    ///
+    virtual void computeLogLKVect(const FeatureBlock& b,
+                 unsigned long first, unsigned long count,
+                 lk_t* logLkVect) const;
+
     /// Returns the constante used to compute likelihood.
     /// @return the value of the constant
     ///
@@ -197,6 +241,26 @@ namespace alize
     unsigned long& dictIndex(const K&);
     unsigned long& refCounter(const K&);
 
+    /// Returns the modification stamp of the distribution. The stamp is
+    /// renewed each time the distribution may have been modified : set
+    /// methods, non constant accessors, operator=(), computeAll()...\n
+    /// Stamps are taken from a counter shared by all the distributions
+    /// and mixtures, so a stamp greater than a value previously returned
+    /// by getLastStamp() means that the object has changed since.
+    /// @return the modification stamp
+    ///
+    unsigned long getStamp() const;
+
+    /// Returns the last stamp given to a distribution or a mixture
+    /// @return the last stamp
+    ///
+    static unsigned long getLastStamp();
+
+    /// Returns a new stamp (internal usage). Safe to call from several
+    /// threads.
+    ///
+    static unsigned long newStamp(const K&);
+
     static Distrib& create(const K&, const DistribType,
                            unsigned long vectSize);
   protected:
@@ -204,10 +268,20 @@ namespace alize
     const unsigned long _vectSize;   /*!< dimension of the distribution */
     real_t              _det;        /*!< determinant */
     real_t              _cst;        /*!< constante */
+    real_t              _logCst;     /*!< log(_cst) */
     DoubleVector        _meanVect;   /*!< mean vector */
+
+    /// Renews the modification stamp. Must be called by the derived
+    /// classes each time their parameters may be modified.
+    ///
+    void updateStamp();
+
   private :
     unsigned long _refCounter;
     unsigned long _dictIndex;
+    unsigned long _stamp;
+
+    static unsigned long _lastStamp;
 
     virtual Distrib& clone() const = 0;
   };
@@ -91,6 +91,7 @@ namespace alize
   {
     friend class TestDistribGD;
     friend class TestMixtureGD;
+    friend class MixtureGDStat;
 
   public :
 
@@ -159,6 +160,24 @@ namespace alize
     virtual lk_t computeLK(const Feature&) const;
     virtual lk_t computeLK(const Feature&, unsigned long idx) const;
 
+    /// Same as Distrib::computeLogLK(), computed without calling exp()
+    ///
+    virtual lk_t computeLogLK(const Feature&) const;
+
+    /// Same as Distrib::computeLogLKVect() but reads the parameters of
+    /// the features directly in the block.
+    ///
+    virtual void computeLogLKVect(const FeatureBlock& b,
+                 unsigned long first, unsigned long count,
+                 lk_t* logLkVect) const;
+
+    /// Like Distrib::computeAndAccumulateLK() but reads the parameters of
+    /// the features directly in the block.
+    ///
+    virtual void computeAndAccumulateLK(const FeatureBlock& b,
+                 unsigned long first, unsigned long count, weight_t w,
+                 lk_t* lkVect) const;
+
     /// Sets a value in the covariance vector.
     /// A zero value is automatically replaced by a positive-and-non-zero
     /// value near to zero.
@@ -226,14 +245,33 @@ namespace alize
     ///
     static DistribGD& create(const K&, const Config& config);
 
+    /// Creates a new DistribGD object without the random initialization
+    /// done by the constructors (internal usage). The mean and inverse
+    /// covariance values, the determinant and the constante are NOT
+    /// initialized : the caller must set all of them (see
+    /// MixtureFileReaderRaw).
+    /// @param vectSize dimension of the distribution
+    /// @return the new DistribGD object
+    ///
+    static DistribGD& createUninitialized(const K&, unsigned long vectSize);
+
     /// Duplicates this DistribGD Object. See copy contructor
     /// @return a reference to the copy
     ///
     DistribGD& duplicate(const K&) const;
     
   private :
+    explicit DistribGD(const K&, unsigned long vectSize);
     virtual Distrib& clone() const;
 
+    /// Returns the mean and covariance arrays without renewing the stamp.
+    /// Used by MixtureGDStat to accumulate EM statistics feature by
+    /// feature : it renews the stamp itself when the accumulators are
+    /// read.
+    ///
+    real_t* getMeanArrayForAccumulation();
+    real_t* getCovArrayForAccumulation();
+
     mutable DoubleVector _covVect;   /*!< temporary covariance
                                           vector. The vector is cleared
                                           after calling computeAll()*/
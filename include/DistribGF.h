@@ -66,6 +66,7 @@
 #endif
 
 #include "Distrib.h"
+#include "Feature.h"
 #include "RealVector.h"
 #include "DoubleSquareMatrix.h"
 
@@ -82,7 +83,16 @@ namespace alize
   /// A temporary array is used to store covariance values. This array
   /// is destroyed after calling computeAll().
   /// Before calling computeAll(), the distribution is not valid for some
-  /// methods.
+  /// methods.\n
+  /// computeAll() also keeps the Cholesky factor of the covariance
+  /// matrix. The block methods (computeAndAccumulateLK() and
+  /// computeLogLKVect()) use it to score several features with a single
+  /// triangular solve. When the inverse covariance matrix is set directly
+  /// (loaded models), the factor is built from it by the first block
+  /// computation. If it is not positive definite, the block methods use
+  /// the inverse covariance matrix.\n
+  /// The likelihood computation methods do not modify the object and can
+  /// be called by several threads at the same time.
   ///
   /// @author Frederic Wils  frederic.wils@lia.univ-avignon.fr
   /// @date 2003
@@ -159,6 +169,22 @@ namespace alize
     ///
     virtual lk_t computeLK(const Feature&) const;
     virtual lk_t computeLK(const Feature&, unsigned long idx) const;
+    virtual lk_t computeLogLK(const Feature&) const;
+
+    /// Same as Distrib::computeAndAccumulateLK(). The features are
+    /// processed in groups sharing the same triangular solve (see
+    /// SimdKernels::choleskyQuadFormVect()).
+    ///
+    virtual void computeAndAccumulateLK(const FeatureBlock& b,
+                 unsigned long first, unsigned long count, weight_t w,
+                 lk_t* lkVect) const;
+
+    /// Same as Distrib::computeLogLKVect(). The features are processed
+    /// in groups sharing the same triangular solve.
+    ///
+    virtual void computeLogLKVect(const FeatureBlock& b,
+                 unsigned long first, unsigned long count,
+                 lk_t* logLkVect) const;
 
     /// Sets a value in the covariance matrix.
     /// WARNING : contrary to class Matrix, colum index is FIRST
@@ -178,6 +204,19 @@ namespace alize
     ///
     virtual void computeAll();
 
+    /// Computes the Cholesky factor of the covariance matrix from the
+    /// inverse covariance matrix now instead of during the first block
+    /// likelihood computation. No factor is kept if the inverse
+    /// covariance matrix is not positive definite.
+    ///
+    void computeCholesky();
+
+    /// Tests whether the Cholesky factor has been computed and matches
+    /// the inverse covariance matrix
+    /// @return true if the block methods use the Cholesky factor
+    ///
+    bool isCholeskyUpToDate() const;
+
     /// Gets a value in the covariance matrix.
     /// WARNING : contrary to class Matrix, colum index is FIRST
     /// argument and row index is SECOND argument<br>
@@ -250,13 +289,26 @@ namespace alize
   private :
 
     virtual Distrib& clone() const;
+    real_t computeDist(const Feature&) const;
+    real_t computeDist(const Feature::data_t*, real_t*) const;
+    void computeDistVect(const Feature::data_t*, unsigned long,
+                         real_t*) const;
+    void setCholesky(const DoubleSquareMatrix&) const;
+    unsigned long buildCholesky() const;
+    bool useCholesky() const;
 
     mutable DoubleSquareMatrix _covMatr;    /*!< temporary covariance
                                           matrix. The matrix is cleared
                                           after calling computeAll()*/
     DoubleSquareMatrix  _covInvMatr; /*!< inverse covariance matrix */
     real_t              _cst;        /*!< constante */
-    DoubleVector        _tmpVect;
+    mutable DoubleVector _cholVect;  /*!< Cholesky factor of the covariance
+                                          matrix, packed column by column
+                                          (see SimdKernels::
+                                          choleskyQuadFormVect()) */
+    mutable unsigned long _cholState; /*!< state of _cholVect, built by
+                                          the first block computation
+                                          (see useCholesky()) */
 
   };
 
@@ -117,6 +117,18 @@ namespace alize
     ///
     real_t invert(DoubleSquareMatrix& m);
 
+    /// Inverts the matrix, computes the determinant and keeps the
+    /// Cholesky factor L of the matrix (A = L*trans(L))\n
+    /// ONLY for symmetric positive definite matrix
+    /// @param m to store the inverted matrix
+    /// @param l to store the Cholesky factor. l(k, i) contains L(i,k) :
+    ///      the factor is stored row by row in l.getArray(). The upper
+    ///      triangle is set to 0.
+    /// @return the determinant
+    /// @exception if the matrix is not a positive definite matrix
+    ///
+    real_t invert(DoubleSquareMatrix& m, DoubleSquareMatrix& l);
+
     /// Sets all the values to a a particular value
     /// @param v the real_t value to set
     ///
@@ -148,11 +160,22 @@ namespace alize
 
     real_t upperCholesky(DoubleSquareMatrix& m);
 
+    /// Computes the Cholesky factor L of the matrix (A = L*trans(L)) and
+    /// the determinant\n
+    /// ONLY for symmetric positive definite matrix
+    /// @param l to store the Cholesky factor (same layout as in
+    ///      invert(DoubleSquareMatrix&, DoubleSquareMatrix&))
+    /// @return the determinant
+    /// @exception if the matrix is not a positive definite matrix
+    ///
+    real_t lowerCholesky(DoubleSquareMatrix& l);
+
   private:
 
     unsigned long _size;
     DoubleVector  _array;
 
+    real_t invert(DoubleSquareMatrix* pM, DoubleSquareMatrix* pL);
     static void choleskyDecomp(real_t*, real_t*, long);
     static void choleskySolve(real_t*, real_t*, real_t*, long);
   };
@@ -0,0 +1,206 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+
+#if !defined(ALIZE_EMDriver_h)
+#define ALIZE_EMDriver_h
+
+#if defined(_WIN32)
+#if defined(ALIZE_EXPORTS)
+#define ALIZE_API __declspec(dllexport)
+#else
+#define ALIZE_API __declspec(dllimport)
+#endif
+#else
+#define ALIZE_API
+#endif
+
+#include "Object.h"
+#include "RefVector.h"
+#include "StatServer.h"
+
+namespace alize
+{
+  class Config;
+  class MixtureGD;
+  class MixtureGDStat;
+  class FeatureBlock;
+  class FeatureServer;
+  class TaskPool;
+
+  /// Runs the EM accumulation of a MixtureGD on several threads.\n
+  /// The features are dealt out to a fixed number of slices, each one
+  /// with its own MixtureGDStat accumulator : every block of features is
+  /// cut into getSliceCount() contiguous parts and part s goes to slice s.
+  /// The slices are processed in parallel by a TaskPool. getEM() then
+  /// sums the accumulators with a pairwise tree (slice 0 += slice 1,
+  /// 2 += 3..., then 0 += 2...) and computes the new model.\n
+  /// Each slice sees the same features in the same order and the sums are
+  /// always made in the same order, so the model does not depend on the
+  /// number of threads. It depends on the number of slices and on the
+  /// limits of the blocks given to accumulate(const FeatureBlock&).\n
+  /// The driver uses its own pool, built with the parameters 'numThread'
+  /// and 'threadPinning', or a pool given to the constructor.\n
+  /// Each slice holds two copies of the mixture : use a small number of
+  /// slices for large mixtures.
+  ///
+  /// @version 3.0
+  /// @date 2026
+
+  class ALIZE_API EMDriver : public Object
+  {
+
+  public :
+
+    /// Creates a driver and resets the accumulators
+    /// @param c the configuration
+    /// @param m the mixture to train. It must not be deleted before this
+    ///      object.
+    /// @param sliceCount the number of slices. Should be greater than or
+    ///      equal to the number of threads.
+    /// @exception Exception if sliceCount is 0
+    ///
+    EMDriver(const Config& c, const MixtureGD& m,
+             unsigned long sliceCount = 32);
+
+    /// Creates a driver using a shared pool of threads and resets the
+    /// accumulators
+    /// @param c the configuration
+    /// @param m the mixture to train. It must not be deleted before this
+    ///      object.
+    /// @param p the pool. It must not be deleted before this object.
+    /// @param sliceCount the number of slices
+    /// @exception Exception if sliceCount is 0
+    ///
+    EMDriver(const Config& c, const MixtureGD& m, TaskPool& p,
+             unsigned long sliceCount = 32);
+
+    virtual ~EMDriver();
+
+    /// Resets the accumulators from the current state of the mixture.
+    /// Must be called before a new iteration when the mixture has been
+    /// updated with the result of getEM().
+    ///
+    void reset();
+
+    /// Accumulates all the features of a block
+    /// @param b the block of features
+    /// @exception Exception if the block vectSize does not match the
+    ///      mixture vectSize
+    ///
+    void accumulate(const FeatureBlock& b);
+
+    /// Accumulates all the valid features of a feature server, from the
+    /// first one. The features are read by blocks of
+    /// FEATURE_BLOCK_SIZE features.
+    /// @param fs the feature server
+    /// @exception Exception if the feature vectSize does not match the
+    ///      mixture vectSize
+    ///
+    void accumulate(FeatureServer& fs);
+
+    /// Sums the accumulators of the slices and computes the new model.
+    /// After this call, accumulate() cannot be called before reset().
+    /// @return the new model. It is owned by the driver and is valid until
+    ///      the next call to reset().
+    ///
+    const MixtureGD& getEM();
+
+    /// Returns the number of accumulated features
+    /// @return the number of accumulated features
+    ///
+    unsigned long getFeatureCount() const;
+
+    /// Returns the number of slices
+    /// @return the number of slices
+    ///
+    unsigned long getSliceCount() const;
+
+    /// Returns the number of threads of the pool
+    /// @return the number of threads
+    ///
+    unsigned long getThreadCount() const;
+
+    /// Number of features read at once by accumulate(FeatureServer&)
+    ///
+    static const unsigned long FEATURE_BLOCK_SIZE = 16384;
+
+    virtual String getClassName() const;
+    virtual String toString() const;
+
+  private :
+
+    const MixtureGD*       _pMixture;
+    StatServer             _statServer;
+    unsigned long          _sliceCount;
+    unsigned long          _featureCount;
+    bool                   _reduced;
+    TaskPool*              _pTaskPool;
+    bool                   _ownTaskPool;
+    RefVector<MixtureGDStat> _statVect;
+
+    class SliceTask;
+    class ReduceTask;
+
+    void init(const Config& c);
+
+    EMDriver(const EMDriver&); /*!Not implemented*/
+    const EMDriver& operator=(const EMDriver&); /*!Not implemented*/
+    bool operator==(const EMDriver&) const; /*!Not implemented*/
+    bool operator!=(const EMDriver&) const; /*!Not implemented*/
+  };
+
+} // end namespace alize
+
+#endif // !defined(ALIZE_EMDriver_h)
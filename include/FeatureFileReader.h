@@ -145,6 +145,9 @@ namespace alize
                              const String& srcName = "");
     virtual bool addFeature(const Feature& f);
     virtual bool readFeature(Feature& f, unsigned long s = 1);
+    virtual unsigned long readFeatureView(FloatFeatureBlock& b,
+                                          unsigned long n);
+    virtual unsigned long readFeatures(FeatureBlock& b, unsigned long n);
 
     virtual bool writeFeature(const Feature& f, unsigned long step = 1);
 
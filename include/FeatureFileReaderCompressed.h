@@ -0,0 +1,204 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+
+#if !defined(ALIZE_FeatureFileReaderCompressed_h)
+#define ALIZE_FeatureFileReaderCompressed_h
+
+#if defined(_WIN32)
+#if defined(ALIZE_EXPORTS)
+#define ALIZE_API __declspec(dllexport)
+#else
+#define ALIZE_API __declspec(dllimport)
+#endif
+#else
+#define ALIZE_API
+#endif
+
+#include "FeatureFileReaderSingle.h"
+#include "RealVector.h"
+
+namespace alize
+{
+  class LabelServer;
+  class Config;
+  class FileReader;
+
+  /// Convenient class for reading features from a compressed feature file
+  /// (format COMPRESSED, written by FeatureFileWriter). The acoustic
+  /// parameters are stored on 16 bits, either as IEEE half precision
+  /// values or as integers with a scale and an offset for each dimension
+  /// (see parameter 'saveFeatureFileCompression'). They are decoded to
+  /// single precision by blocks, using SimdKernels.\n
+  /// The file is opened only after calling one of the methods
+  /// readFeature, getFeatureCount, getVectSize, getFeatureFlags.\n
+  /// File layout (the byte order is given by the byte order mark) :\n
+  /// > bytes 0-7   : "ALIZECFF"\n
+  /// > bytes 8-11  : version (1)\n
+  /// > bytes 12-15 : byte order mark (0x01020304)\n
+  /// > bytes 16-19 : encoding (1 = half precision, 2 = int16)\n
+  /// > bytes 20-23 : vectSize\n
+  /// > bytes 24-27 : number of features\n
+  /// > bytes 28-35 : feature flags ("101000" for example)\n
+  /// > bytes 36-39 : sample rate (float)\n
+  /// > bytes 40-63 : reserved (0)\n
+  /// > int16 only : vectSize scales then vectSize offsets (floats)\n
+  /// > the features, vectSize values of 16 bits each.
+  ///
+  /// @version 3.0
+  /// @date 2026
+
+  class ALIZE_API FeatureFileReaderCompressed
+    : public FeatureFileReaderSingle
+  {
+
+  public :
+
+    /// Creates a reader for a compressed feature file.
+    /// @param f a file to read. No path is
+    ///    required. It uses the parameter "featureFilesPath" of the
+    ///    configuration.
+    /// @param c the configuration to use
+    /// @param ls address of a label server. can be NULL.
+    ///
+    FeatureFileReaderCompressed(const FileName& f,
+       const Config& c, LabelServer* ls = NULL,
+       BufferUsage b = BUFFER_AUTO, unsigned long bufferSize = 0,
+       HistoricUsage = ALL_FEATURES, unsigned long historicSize = 0);
+
+    /// See constructor with same parameters
+    ///
+    static FeatureFileReaderCompressed& create(const FileName&,
+       const Config& c, LabelServer* ls = NULL,
+       BufferUsage b = BUFFER_AUTO, unsigned long bufferSize = 0,
+       HistoricUsage = ALL_FEATURES, unsigned long historicSize = 0);
+
+    virtual ~FeatureFileReaderCompressed();
+
+    /// Returns the number of features in the file
+    /// @return the number of features in the file
+    /// @exception IOException if an I/O error occurs
+    /// @exception FileNotFoundException
+    /// @exception InvalidDataException thrown if the file is not a valid
+    ///      compressed feature file
+    ///
+    virtual unsigned long getFeatureCount();
+
+    /// Returns the size of the vector inside the features of this file
+    /// @return the size of the vector inside the features of this file
+    /// @exception IOException if an I/O error occurs
+    /// @exception FileNotFoundException
+    /// @exception InvalidDataException thrown if the file is not a valid
+    ///      compressed feature file
+    ///
+    virtual unsigned long getVectSize();
+
+    /// Returns the feature flags of this file
+    /// @return the feature flags of this file
+    /// @exception IOException if an I/O error occurs
+    /// @exception FileNotFoundException
+    /// @exception InvalidDataException thrown if the file is not a valid
+    ///      compressed feature file
+    ///
+    virtual const FeatureFlags& getFeatureFlags();
+
+    /// Returns the sample rate of this file.
+    /// @return the sample rate of this file
+    /// @exception IOException if an I/O error occurs
+    /// @exception FileNotFoundException
+    /// @exception InvalidDataException thrown if the file is not a valid
+    ///      compressed feature file
+    ///
+    virtual real_t getSampleRate();
+
+    /// Returns the encoding of the acoustic parameters
+    /// @return FeatureFileCompression_FLOAT16 or FeatureFileCompression_INT16
+    /// @exception IOException if an I/O error occurs
+    /// @exception FileNotFoundException
+    /// @exception InvalidDataException thrown if the file is not a valid
+    ///      compressed feature file
+    ///
+    FeatureFileCompression getCompression();
+
+    virtual String getClassName() const;
+
+  private :
+
+    bool _paramDefined;
+    FeatureFileCompression _compression;
+    FloatVector     _scaleVect;  /*!< int16 only */
+    FloatVector     _offsetVect; /*!< int16 only */
+    unsigned short* _pData;      /*!< encoded values read from the file */
+    unsigned long   _dataSize;   /*!< capacity of _pData */
+
+    void readParams();
+    bool readHeader();
+    virtual unsigned long getHeaderLength();
+    virtual void seekFeatureData(unsigned long idx);
+    virtual unsigned long readFeatureData(FloatVector& v);
+    virtual bool featureDataIsFloat();
+
+    bool operator==(const FeatureFileReaderCompressed&)
+                         const; /*!Not implemented*/
+    bool operator!=(const FeatureFileReaderCompressed&)
+                         const; /*!Not implemented*/
+    const FeatureFileReaderCompressed& operator=(
+             const FeatureFileReaderCompressed&); /*!Not implemented*/
+    FeatureFileReaderCompressed(
+             const FeatureFileReaderCompressed&); /*!Not implemented*/
+  };
+
+} // end namespace alize
+
+#endif // !defined(ALIZE_FeatureFileReaderCompressed_h)
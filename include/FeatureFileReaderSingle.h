@@ -67,6 +67,7 @@
 
 #include "FeatureFileReaderAbstract.h"
 #include "Feature.h"
+#include "Label.h"
 #include "RealVector.h"
 
 namespace alize
@@ -74,7 +75,22 @@ namespace alize
   class Config;
   class FileReader;
   
-  /// Abstract base class for feature file readers
+  /// Abstract base class for feature file readers\n
+  /// When the parameter 'loadFeatureFileReadAhead' is true and the
+  /// file does not fit in the buffer, the block following the buffer is
+  /// loaded in a second buffer by a background thread while the first one
+  /// is read (sequential reading only needs to wait for the disk when
+  /// the features are consumed faster than they are loaded). It doubles
+  /// the memory used by the buffer. Requires thread support (THREAD
+  /// defined at compile time).\n
+  /// When the parameter 'loadFeatureFileMemoryMap' is true, the file is
+  /// mapped in memory (see FileReader::map()) and the features are read
+  /// directly from the mapping instead of being copied in the buffer.
+  /// The mapping is advised for sequential access until the first
+  /// non-sequential read, then for random access. It is not used when
+  /// the data must be byte-swapped, when the header length is not a
+  /// multiple of 4 or after a call to writeFeature() or addFeature().
+  ///
   /// @author Frederic Wils  frederic.wils@lia.univ-avignon.fr
   /// @version 1.0
   /// @date 2003
@@ -95,6 +111,19 @@ namespace alize
     virtual void close();
 
     virtual bool readFeature(Feature&, unsigned long step = 1);
+
+    /// The block is a view on the memory mapping of the file (see
+    /// parameter 'loadFeatureFileMemoryMap') or on the buffer. In the
+    /// second case, the features read are limited to the end of the buffer.
+    ///
+    virtual unsigned long readFeatureView(FloatFeatureBlock& b,
+                                          unsigned long n);
+
+    /// The features are converted directly from the buffer (or from the
+    /// memory mapping of the file) to the block, one block of the buffer
+    /// at a time.
+    ///
+    virtual unsigned long readFeatures(FeatureBlock& b, unsigned long n);
     virtual bool addFeature(const Feature& f);
     virtual bool writeFeature(const Feature& f, unsigned long step = 1);
     virtual unsigned long getSourceCount();
@@ -105,6 +134,16 @@ namespace alize
     virtual const String& getNameOfASource(unsigned long srcIdx);
 
     virtual void setExternalBufferToUse(FloatVector& v);
+
+    /// Returns the acoustic parameters of a feature directly in the
+    /// memory mapping of the file (see parameter 'loadFeatureFileMemoryMap')
+    /// @param idx index of the feature
+    /// @return a pointer on the first parameter of the feature, or NULL if
+    ///      the file is not mapped
+    /// @warning The pointer is invalidated by close()
+    /// @exception IndexOutOfBoundsException
+    ///
+    const float* getMappedFeature(unsigned long idx);
     
     virtual String toString() const;
 
@@ -130,10 +169,87 @@ namespace alize
     String getExt(const FileName&, const Config&) const;
     bool getBigEndian(const Config&, BigEndian) const;
 
+    /// Waits for the end of the pending read-ahead, if any. Never throws :
+    /// the destructors of the derived classes must call it before their
+    /// own data used by readFeatureData() is destroyed.
+    ///
+    void stopReadAhead();
+
   private :
 
+    struct ReadAhead;
+
+    // read-ahead buffer (see parameter 'loadFeatureFileReadAhead')
+    FloatVector*    _pNextBuffer;
+    unsigned long   _featureIndexOfNextBuffer;
+    unsigned long   _nbStoredInNextBuffer;
+    ReadAhead*      _pReadAhead; /*!< pending read-ahead, NULL if none */
+    bool            _seekNeeded; /*!< file position is unknown */
+    // memory mapping (see parameter 'loadFeatureFileMemoryMap')
+    bool            _mappingDisabled;
+    unsigned long   _nextMappedFeatureIndex; /*!< to detect random access */
+    // label of the source, built once (see getSourceLabelCode())
+    Label           _sourceLabel;
+    bool            _sourceLabelDefined;
+    unsigned long   _sourceLabelCode;
+
     virtual unsigned long getHeaderLength();
     bool featureWantedIsInHistoric() const;
+
+    /// Positions the file at the beginning of a feature. By default, the
+    /// features are stored as raw floats after the header.
+    /// @param idx index of the feature
+    ///
+    virtual void seekFeatureData(unsigned long idx);
+
+    /// Decodes the features stored from the current position of the file
+    /// into a vector. Called by the read-ahead thread : must not modify
+    /// the state of the object except the position of the file.
+    /// @param v the vector to fill
+    /// @return the number of values read
+    ///
+    virtual unsigned long readFeatureData(FloatVector& v);
+
+    /// Tells whether the features are stored as native floats and can be
+    /// used through a memory mapping (see getMappedFeature())
+    /// @return true by default
+    ///
+    virtual bool featureDataIsFloat();
+
+    /// Maps the file if needed and allowed
+    /// @return a pointer on the first parameter of the first feature in
+    ///      the mapping, or NULL if the buffer must be used
+    ///
+    const float* getMappedFeatures();
+
+    /// Positions the stream, loads the buffer if needed and moves the
+    /// pointer after the features available contiguously in memory
+    /// @param n maximum number of features wanted. Set to the number of
+    ///      features available (0 at the end of the file).
+    /// @return a pointer on the first parameter of the first feature in
+    ///      the buffer or in the mapping
+    ///
+    const float* readFrames(unsigned long& n);
+
+    /// Returns the code of the label of the source in the label server.
+    /// The code is cached and only checked for each feature.
+    /// @return the label code
+    ///
+    unsigned long getSourceLabelCode();
+
+    /// Releases the mapping and forbids to map the file again
+    ///
+    void disableMapping();
+
+    /// Starts to load the block following the buffer in a background
+    /// thread, if the read-ahead is enabled
+    ///
+    void startReadAhead();
+
+    /// Waits for the end of the pending read-ahead, if any
+    /// @return true if the next buffer has been loaded
+    ///
+    bool waitReadAhead();
   };
 
 } // end namespace alize
@@ -66,10 +66,13 @@
 #endif
 
 #include "FileWriter.h"
+#include "RealVector.h"
 
 namespace alize
 {
   class Feature;
+  class FeatureBlock;
+  class FloatFeatureBlock;
   class Config;
 
   /*!
@@ -77,6 +80,15 @@ namespace alize
   In the RAW format, the dimension of the features is not saved. Each data
   of each feature is saved as a double float value (8 bytes).
   In the SPRO formats, the flags comes from the configuration.
+  In the COMPRESSED format, each parameter is stored on 16 bits, as a half
+  precision value (default) or as an integer with a scale and an offset
+  for each dimension (see parameter 'saveFeatureFileCompression'). With the
+  int16 encoding, the scales and offsets depend on the range of all the
+  features : they are kept in memory and written by close().
+  A compressed file can be read using a FeatureFileReaderCompressed object.
+  The data are written by blocks (see FileWriter). If the parameter
+  'saveFeatureFileBackgroundFlush' is true, the blocks are written by a
+  background thread.
   A raw file can be read using a FeatureFileReaderRaw object.\n
   
   @author Frederic Wils  frederic.wils@lia.univ-avignon.fr
@@ -122,6 +134,23 @@ namespace alize
     ///
     virtual void writeFeature(const Feature& feature);
 
+    /// Writes all the features of a block to the file
+    /// @param b the block to save
+    /// @exception IOException if an I/O error occurs
+    /// @exception Exception if the block vectSize does not match
+    ///      previous features
+    ///
+    void writeFeatures(const FeatureBlock& b);
+
+    /// Writes all the features of a block to the file. The single
+    /// precision values are written without conversion.
+    /// @param b the block to save
+    /// @exception IOException if an I/O error occurs
+    /// @exception Exception if the block vectSize does not match
+    ///      previous features
+    ///
+    void writeFeatures(const FloatFeatureBlock& b);
+
     virtual String getClassName() const;
 
   private :
@@ -132,8 +161,20 @@ namespace alize
     unsigned long           _featureCount;
     bool                    _headerWritten; // for SPRO format
     const Config&           _config;
+    // COMPRESSED format
+    FeatureFileCompression  _compression;
+    FloatVector             _dataVect; /*!< int16 : features to quantize */
+    unsigned long           _dataCapacity; /*!< reserved in _dataVect */
+    unsigned short*         _pCodeBuffer; /*!< encoded values */
+    unsigned long           _codeBufferSize;
+    FloatVector             _frameVect; /*!< single precision features */
 
     String getFullFileName(const Config& c, const String& n) const;
+    void writeFrames(const float* p, unsigned long vectSize,
+                     unsigned long count);
+    void writeHeader();
+    void writeCompressedHeader(unsigned long featureCount);
+    void writeQuantizedFeatures();
     FeatureFileWriter(const FeatureFileWriter&);   /*!Not implemented*/
     const FeatureFileWriter& operator=(
                 const FeatureFileWriter&); /*!Not implemented*/
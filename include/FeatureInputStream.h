@@ -72,6 +72,8 @@
 namespace alize
 {
   class Feature;
+  class FeatureBlock;
+  class FloatFeatureBlock;
   class LabelServer;
   class Config;
   
@@ -126,6 +128,42 @@ namespace alize
     ///
     virtual bool readFeature(Feature& f, unsigned long s = 1) = 0;
 
+    /// Reads up to n consecutive features and moves the pointer forward.
+    /// When the stream can (see FeatureFileReaderSingle), the block
+    /// becomes a view on the buffer of the stream (or on the memory
+    /// mapping of the file) and nothing is copied. Otherwise the features
+    /// are copied in the block. Label codes are not set.
+    /// @param b the block to fill. Its vectSize is set to the vectSize of
+    ///      the stream.
+    /// @param n maximum number of features to read
+    /// @return the number of features read. Can be lower than n even if
+    ///      the end of the stream has not been reached (end of the buffer
+    ///      of the stream). 0 if there is no more data.
+    /// @warning A view is invalidated by the next call of a read, write,
+    ///      seek, reset or close method of the stream (or of the
+    ///      streams it reads), and by its destruction.
+    /// @exception IOException if an I/O error occurs
+    ///
+    virtual unsigned long readFeatureView(FloatFeatureBlock& b,
+                                          unsigned long n);
+
+    /// Reads up to n consecutive features, appends them to a block and
+    /// moves the pointer forward. Equivalent to n calls of readFeature()
+    /// but the streams that implement it natively (file readers, feature
+    /// servers, modifiers) check the position and the buffer once per
+    /// block instead of once per feature. Label codes and validity flags
+    /// are not kept. A feature out of the historic stops the reading.
+    /// @param b the block to fill. If it is empty, its vectSize is set to
+    ///      the vectSize of the stream.
+    /// @param n maximum number of features to read
+    /// @return the number of features read. Lower than n only if the end
+    ///      of the stream has been reached.
+    /// @exception Exception if the block is not empty and its vectSize is
+    ///      not the vectSize of the stream
+    /// @exception IOException if an I/O error occurs
+    ///
+    virtual unsigned long readFeatures(FeatureBlock& b, unsigned long n);
+
     /// adds a feature in the buffer is enougth memory have been allocated by 
     /// featureServerMemAlloc option
     /// @param f the feature to add in the buffer
@@ -240,6 +278,13 @@ namespace alize
     bool          _featuresAreWritable;
     void init(const Config& c, LabelServer* ls = NULL);
 
+    /// Checks or sets the vectSize of a block before appending features
+    /// of this stream to it (see readFeatures())
+    /// @param b the block
+    /// @return the number of features already in the block
+    ///
+    unsigned long prepareBlock(FeatureBlock& b);
+
   private :
     const Config* _pConfig;
   };
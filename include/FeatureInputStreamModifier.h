@@ -68,6 +68,7 @@
 #include "FeatureInputStream.h"
 #include "alizeString.h"
 #include "Feature.h"
+#include "FeatureBlock.h"
 #include "ULongVector.h"
 
 namespace alize
@@ -116,6 +117,17 @@ namespace alize
 
     virtual bool readFeature(Feature& f, unsigned long step = 1);
 
+    /// Without mask, the view given by the input stream is returned.
+    /// With a mask, the selected parameters are copied in the block.
+    ///
+    virtual unsigned long readFeatureView(FloatFeatureBlock& b,
+                                          unsigned long n);
+
+    /// With a mask, the features are read in a block by the input stream
+    /// and the selected parameters are copied in b
+    ///
+    virtual unsigned long readFeatures(FeatureBlock& b, unsigned long n);
+
     virtual bool writeFeature(const Feature& f, unsigned long step = 1);
 
     /// Returns the number of features in the file.
@@ -200,6 +212,7 @@ namespace alize
 
     FeatureInputStream* _pInput;
     Feature             _feature;
+    FeatureBlock        _block; /*!< see readFeatures() */
     String              _mask;
     String              _tmpMask;
     ULongVector         _selection;
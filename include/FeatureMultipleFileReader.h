@@ -128,6 +128,11 @@ namespace alize
 
     virtual bool readFeature(Feature& f, unsigned long step = 1);
 
+    /// The features are read by the readers of the files, one file at a
+    /// time
+    ///
+    virtual unsigned long readFeatures(FeatureBlock& b, unsigned long n);
+
     virtual bool writeFeature(const Feature& f, unsigned long step = 1);
 
     /// Returns the number of features in all the files
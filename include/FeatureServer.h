@@ -231,6 +231,11 @@ namespace alize
     ///    
     virtual bool readFeature(Feature& f, unsigned long s = 1);
 
+    virtual unsigned long readFeatureView(FloatFeatureBlock& b,
+                                          unsigned long n);
+
+    virtual unsigned long readFeatures(FeatureBlock& b, unsigned long n);
+
     /// adds a feature
     /// @param f the feature to store the data read
     /// @return false not possible to add feature
@@ -174,6 +174,14 @@ namespace alize
     ///
     FloatVector& readFloats(FloatVector& v);
 
+    /// Reads bytes without any conversion (see swap())
+    /// @param buffer to store the bytes
+    /// @param length the number of bytes to read
+    /// @exception IOException if an I/O error occurs
+    /// @exception EOFException if end of file has been reached
+    ///
+    void readBytes(void* buffer, unsigned long length);
+
     /// Tries to read a set of float value (4 bytes). The number is
     /// determined by the smaller between vector size and the number
     /// of available float values in the stream before the end of its
@@ -183,6 +191,15 @@ namespace alize
     /// @exception IOException if an I/O error occurs
     ///
     unsigned long readSomeFloats(FloatVector& v);
+
+    /// Tries to read bytes without any conversion. Less than 'length'
+    /// bytes are read only if the end of the file is reached.
+    /// @param buffer to store the bytes
+    /// @param length the maximum number of bytes to read
+    /// @return the number of bytes read. 0 at the end of the file.
+    /// @exception IOException if an I/O error occurs
+    ///
+    unsigned long readSomeBytes(void* buffer, unsigned long length);
     
     /// Reads the next line of text from the input stream. It reads
     /// successive bytes until it encounters a line terminator or end of
@@ -236,6 +253,36 @@ namespace alize
     ///
     void seek(unsigned long pos);
 
+    /// Maps the whole file in memory (read only). The file is opened
+    /// separately : the stream used by the read methods is not modified.
+    /// The mapping is released by unmap() or close(). Not available on
+    /// Windows.
+    /// @param sequential true if the data will be read sequentially,
+    ///      false for random access (see adviseMapping())
+    /// @return a pointer on the first byte of the file, or NULL if the
+    ///      file cannot be mapped (empty file, system error...)
+    /// @exception FileNotFoundException
+    ///
+    const char* map(bool sequential = true);
+
+    /// Tells the system how the mapping will be accessed, so that it can
+    /// read the pages ahead (sequential) or only the pages used (random).
+    /// Does nothing if the file is not mapped.
+    /// @param sequential true for sequential access, false for random
+    ///      access
+    ///
+    void adviseMapping(bool sequential);
+
+    /// Returns the current mapping of the file
+    /// @return a pointer on the first byte of the file, or NULL if the
+    ///      file is not mapped
+    ///
+    const char* getMapping() const;
+
+    /// Releases the mapping of the file, if any
+    ///
+    void unmap();
+
     void rewind();
     long tell();
     bool& swap();
@@ -263,6 +310,8 @@ namespace alize
     bool           _fileLengthDefined;
     mutable String _string; /*! to store temporary data */
     bool           _swap; /*! flag for numeric data */
+    void*          _pMapping; /*! see map(). Can be NULL */
+    bool           _mappingIsSequential;
 
     /// Low-level method to read bytes from a file.
     /// @param buffer A pointer to a memory area to store the data
@@ -72,7 +72,10 @@
 namespace alize
 {
 
-  /// Convenient class used to write data to a file
+  /// Convenient class used to write data to a file.\n
+  /// The data are gathered in an internal buffer and written to the file
+  /// by blocks. Optionally, the blocks are written by a background thread
+  /// while the next one is filled (see setBackgroundFlush()).
   ///
   /// @author Frederic Wils  frederic.wils@lia.univ-avignon.fr
   /// @version 1.0
@@ -91,10 +94,21 @@ namespace alize
     ///
     virtual void close();
 
+    /// Enables or disables the background flush : each full buffer is
+    /// written to the file by a separate thread while the next one is
+    /// filled. The thread runs from the opening of the file until
+    /// close(); its write errors are reported by the next flush or by
+    /// close(). Has no effect if the library is compiled without thread
+    /// support.
+    /// @param on true to enable the background flush
+    /// @exception IOException if an I/O error occurs while writing the
+    ///      buffered data
+    ///
+    void setBackgroundFlush(bool on);
+
     virtual String getClassName() const;
     virtual String toString() const;
 
-
   protected:
 
     FILE*    _pFileStruct;
@@ -133,6 +147,24 @@ namespace alize
     ///
     void writeChar(char value);
 
+    /// Writes a block of bytes
+    /// @param buffer the first byte
+    /// @param length the number of bytes
+    /// @exception IOException if an I/O error occurs
+    ///
+    void writeBytes(const void* buffer, unsigned long length);
+
+    /// Writes the buffered data to the file
+    /// @exception IOException if an I/O error occurs
+    ///
+    void flush();
+
+    /// Writes the buffered data then moves the position in the file
+    /// @param pos the new position from the beginning of the file
+    /// @exception IOException if an I/O error occurs
+    ///
+    void seek(unsigned long pos);
+
     /// @exception IOException if an I/O error occurs
     ///
     void writeString(const String& string);
@@ -151,6 +183,23 @@ namespace alize
 
   private :
 
+    struct BackgroundFlush;
+
+    char*            _pBuffer;      /*!< data not written yet */
+    unsigned long    _bufferLength; /*!< number of bytes in _pBuffer */
+    unsigned long    _bufferSize;   /*!< capacity of _pBuffer */
+    char*            _pFlushBuffer; /*!< written by the background thread */
+    BackgroundFlush* _pBackgroundFlush; /*!< flush thread, NULL if none */
+    bool             _backgroundFlush;
+
+    void allocateBuffers();
+    void freeBuffers();
+    void flushBuffer();
+    void startBackgroundFlush();
+    void stopBackgroundFlush();
+    void waitBackgroundFlush();
+    void writeFile(const void* buffer, unsigned long length);
+
     FileWriter(const FileWriter&); /*!Not implemented*/
     const FileWriter& operator=(const FileWriter&); /*!Not implemented*/
     bool operator==(const FileWriter&) const; /*!Not implemented*/
@@ -0,0 +1,219 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+#if !defined(ALIZE_FloatFeatureBlock_h)
+#define ALIZE_FloatFeatureBlock_h
+
+#if defined(_WIN32)
+#if defined(ALIZE_EXPORTS)
+#define ALIZE_API __declspec(dllexport)
+#else
+#define ALIZE_API __declspec(dllimport)
+#endif
+#else
+#define ALIZE_API
+#endif
+
+#include "Object.h"
+#include "Feature.h"
+#include "RealVector.h"
+
+namespace alize
+{
+  /// Single precision version of FeatureBlock. The acoustic parameters
+  /// are stored as float values, the format of the feature files, so
+  /// that features can be loaded without conversion (see addData()).
+  /// It is used by the single precision methods of StatServer.\n
+  /// A block can also be a view on features stored elsewhere, for example
+  /// in the buffer of a feature stream (see setView() and
+  /// FeatureInputStream::readFeatureView()). A view does not own nor copy
+  /// the data : the data must stay valid while the block is used. The
+  /// block gets its own copy of the features as soon as it is modified.\n
+  /// Only the acoustic parameters are stored : validity flags and label
+  /// codes are not kept.
+  ///
+  /// @version 3.0
+  /// @date 2026
+
+  class ALIZE_API FloatFeatureBlock : public Object
+  {
+
+  public :
+
+    typedef float data_t;
+
+    /// Creates an empty block of features
+    /// @param vectSize size of the acoustic parameters vector
+    /// @param capacity number of features that can be stored before
+    ///    reallocation
+    ///
+    explicit FloatFeatureBlock(unsigned long vectSize = 0,
+                               unsigned long capacity = 0);
+
+    FloatFeatureBlock(const FloatFeatureBlock&);
+    const FloatFeatureBlock& operator=(const FloatFeatureBlock&);
+    virtual ~FloatFeatureBlock();
+
+    /// Returns the size of the acoustic parameters vector
+    /// @return the size of the acoustic parameters vector
+    ///
+    unsigned long getVectSize() const;
+
+    /// Sets the size of the acoustic parameters vector. All the
+    /// features are removed from the block.
+    /// @param vectSize the new size
+    ///
+    void setVectSize(unsigned long vectSize);
+
+    /// Returns the number of features stored in the block
+    /// @return the number of features
+    ///
+    unsigned long getFeatureCount() const;
+
+    /// Sets the number of features stored in the block. New features
+    /// are not initialized.
+    /// @param n the number of features
+    ///
+    void setFeatureCount(unsigned long n);
+
+    /// Removes all the features. Does not free memory.
+    ///
+    void clear();
+
+    /// Makes the block a view on features stored contiguously elsewhere.
+    /// The previous content of the block is lost.
+    /// @param data the acoustic parameters of the features. They must
+    ///      stay valid and unchanged while the block is a view.
+    /// @param featureCount number of features
+    ///
+    void setView(const float* data, unsigned long featureCount);
+
+    /// Tests whether the block is a view on data it does not own (see
+    /// setView()). setFeatureCount(), addData(), addFeature() and
+    /// setFeature() copy the data in the block before modifying it, and
+    /// clear() and setVectSize() end the view.
+    /// @return true if the block is a view
+    ///
+    bool isView() const;
+
+    /// Appends features stored contiguously (for example a buffer filled
+    /// by FileReader::readSomeFloats())
+    /// @param data the acoustic parameters of the features
+    /// @param featureCount number of features to append
+    ///
+    void addData(const float* data, unsigned long featureCount);
+
+    /// Appends a copy of the acoustic parameters of a feature. The values
+    /// are converted to float.
+    /// @param f the feature
+    /// @exception Exception if the feature vectSize does not match the
+    ///      block vectSize
+    ///
+    void addFeature(const Feature& f);
+
+    /// Copies the acoustic parameters of a feature in the block. The
+    /// values are converted to float.
+    /// @param f the feature
+    /// @param idx index of the feature in the block
+    /// @exception Exception if the feature vectSize does not match the
+    ///      block vectSize
+    /// @exception IndexOutOfBoundsException
+    ///
+    void setFeature(const Feature& f, unsigned long idx);
+
+    /// Copies the acoustic parameters of a feature of the block into
+    /// a Feature object
+    /// @param f the feature to fill
+    /// @param idx index of the feature in the block
+    /// @exception Exception if the feature vectSize does not match the
+    ///      block vectSize
+    /// @exception IndexOutOfBoundsException
+    ///
+    void getFeature(Feature& f, unsigned long idx) const;
+
+    /// Use this method to access directly to the parameters of a feature
+    /// @param idx index of the feature in the block
+    /// @return a pointer on the first acoustic parameter of the feature
+    /// @warning Fast but dangerous ! The pointer is invalidated when the
+    ///      block grows. The data of a view must not be modified.
+    ///
+    data_t* getFeatureVector(unsigned long idx) const;
+
+    /// Use this method to access directly to the internal vector
+    /// @return a pointer on the first acoustic parameter of the first
+    ///      feature
+    /// @warning Fast but dangerous ! The pointer is invalidated when the
+    ///      block grows. The data of a view must not be modified.
+    ///
+    data_t* getDataVector() const;
+
+    virtual String getClassName() const;
+    virtual String toString() const;
+
+  private :
+
+    unsigned long _vectSize;
+    unsigned long _featureCount;
+    FloatVector   _dataVect;
+    data_t*       _pView; /*!< viewed data, NULL if the block owns its data */
+
+    void detach();
+
+    bool operator==(const FloatFeatureBlock&) const; /*!Not implemented*/
+    bool operator!=(const FloatFeatureBlock&) const; /*!Not implemented*/
+  };
+
+} // end namespace alize
+
+#endif // !defined(ALIZE_FloatFeatureBlock_h)
@@ -0,0 +1,116 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+#if !defined(ALIZE_Gemm_h)
+#define ALIZE_Gemm_h
+
+#if defined(_WIN32)
+#if defined(ALIZE_EXPORTS)
+#define ALIZE_API __declspec(dllexport)
+#else
+#define ALIZE_API __declspec(dllimport)
+#endif
+#else
+#define ALIZE_API
+#endif
+
+#include "alizeString.h"
+
+namespace alize
+{
+  /// Dense matrix product used by the block-oriented likelihood
+  /// computation of StatServer. Matrices are stored row by row.\n
+  /// When the library is configured with --with-cblas (HAVE_CBLAS),
+  /// cblas_dgemm() is used and the programs must link the CBLAS library.
+  /// Otherwise, a cache-blocked implementation is used.
+  ///
+  /// @version 3.0
+  /// @date 2026
+
+  class ALIZE_API Gemm
+  {
+
+  public :
+
+    /// Computes c = a * transpose(b)\n
+    /// c[i*ldc+j] = sum for l in [0,k[ of a[i*lda+l] * b[j*ldb+l]
+    /// @param m number of rows of a and c
+    /// @param n number of rows of b and number of columns of c
+    /// @param k number of columns of a and b
+    /// @param a first matrix
+    /// @param lda distance between two rows of a
+    /// @param b second matrix
+    /// @param ldb distance between two rows of b
+    /// @param c result matrix
+    /// @param ldc distance between two rows of c
+    ///
+    static void multiplyByTransposed(unsigned long m, unsigned long n,
+                unsigned long k, const real_t* a, unsigned long lda,
+                const real_t* b, unsigned long ldb,
+                real_t* c, unsigned long ldc);
+
+    /// Returns the name of the implementation used by
+    /// multiplyByTransposed() : "cblas" or "internal"
+    /// @return the name of the implementation
+    ///
+    static String getImplementationName();
+
+  private :
+
+    Gemm(); /*!Not implemented*/
+  };
+
+} // end namespace alize
+
+#endif // !defined(ALIZE_Gemm_h)
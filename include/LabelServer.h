@@ -68,12 +68,17 @@
 #include "Object.h"
 #include "RefVector.h"
 #include "Label.h"
+#include "ULongVector.h"
 
 namespace alize
 {
   /*!
   This class is a container for Label objects. Each Label got an index.
-  This index is used to set the label code in a feature. 
+  This index is used to set the label code in a feature. \n
+  The labels are indexed by hash tables (on the whole content and on the
+  string only), so addLabel() and getLabelIndexByString() run in constant
+  time whatever the number of labels. A label must not be modified
+  through the reference returned by getLabel() : use setLabel().
   @deprecated since jan 2005
   
   @author Frederic Wils  frederic.wils@lia.univ-avignon.fr
@@ -129,7 +134,7 @@ namespace alize
     ///
     Label& getLabel(unsigned long index) const;
 
-    /// Find and returns the index of a label
+    /// Find and returns the index of the first label with a given string
     /// @param s the string used as a key to search the label
     /// @return the index of the label if it exists; -1 otherwise
     ///
@@ -155,6 +160,17 @@ namespace alize
     unsigned long   _first; /*! index of the first non-predefined label */
     unsigned long   _lastAdded;/*! index of the last label added*/
     RefVector<Label> _vect;
+    // hash tables (open addressing) giving the index of the first label
+    // with a given content (_labelIndex) or a given string (_stringIndex)
+    mutable ULongVector _labelIndex;
+    mutable ULongVector _stringIndex;
+    mutable unsigned long _labelIndexCount; /*! entries in _labelIndex */
+    mutable unsigned long _stringIndexCount; /*! entries in _stringIndex */
+
+    unsigned long findSlot(const ULongVector& table, const String& s,
+                           const String* pSrcName) const;
+    void addToIndex(unsigned long labelIdx) const;
+    void rebuildIndex(unsigned long tableSize) const;
 
     LabelServer(const LabelServer&); /*! Not implemented */
     const LabelServer& operator=(const LabelServer&); /*! Not implemented*/
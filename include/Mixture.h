@@ -203,6 +203,14 @@ namespace alize
 
     virtual DistribType getType() const = 0;
 
+    /// Returns the modification stamp of the mixture. The stamp is
+    /// renewed each time the weights or the list of distributions may
+    /// have been modified. It does not change when a distribution is
+    /// modified : see Distrib::getStamp().
+    /// @return the modification stamp
+    ///
+    unsigned long getStamp() const;
+
     /// Internal usage
     ///
     virtual MixtureStat& createNewMixtureStatObject(const K&,
@@ -229,6 +237,7 @@ namespace alize
     DoubleVector   _weightVect;  // a vector for weights
     DistribRefVector _distribVect; // a vector for distributions
     String       _id;      // identifier of the mixture
+    unsigned long _stamp;  // modification stamp
     
     virtual Mixture& clone(DuplDistrib) const = 0;
   };
@@ -140,6 +140,8 @@ namespace alize
 
   private :
 
+    void eofError();
+
     bool operator==(const MixtureFileReaderRaw&)
                           const; /*!Not implemented*/
     bool operator!=(const MixtureFileReaderRaw&)
@@ -100,7 +100,6 @@ namespace alize
 
   private :
 
-    unsigned long _line;
 
     unsigned long _distribCount;
     bool          _distribCountFound;
@@ -138,7 +137,6 @@ namespace alize
     DistribGD& distribGD();
     DistribGF& distribGF();
     const DistribType& type();
-    virtual const String& readOneChar();
     virtual void eventOpeningElement(const String& path);
     virtual void eventClosingElement(const String& path,
                      const String& value);
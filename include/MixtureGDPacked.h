@@ -0,0 +1,256 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+#if !defined(ALIZE_MixtureGDPacked_h)
+#define ALIZE_MixtureGDPacked_h
+
+#if defined(_WIN32)
+#if defined(ALIZE_EXPORTS)
+#define ALIZE_API __declspec(dllexport)
+#else
+#define ALIZE_API __declspec(dllimport)
+#endif
+#else
+#define ALIZE_API
+#endif
+
+#include "Object.h"
+#include "RealVector.h"
+
+namespace alize
+{
+  class MixtureGD;
+
+  /// Read-only compiled form of a MixtureGD object, used for fast
+  /// likelihood computation.\n
+  /// The parameters of all the distributions are stored in contiguous
+  /// matrices (one row per distribution) instead of one object per
+  /// distribution :\n
+  /// > mean matrix\n
+  /// > inverse covariance matrix\n
+  /// > weights, constants and their logarithms\n
+  /// > terms of the expanded quadratic form, used to compute the
+  /// log-likelihoods of many features with a matrix product (see
+  /// getGemmMatrix())\n
+  /// > single precision copies of the mean and inverse covariance
+  /// matrices, used to score FloatFeatureBlock objects.\n
+  /// Each row of the matrices starts on a 64-byte boundary. The distance
+  /// between two rows is given by getStride().\n
+  /// The object keeps a reference to the source mixture. It is out of
+  /// date as soon as the mixture or one of its distributions is modified
+  /// (see Mixture::getStamp() and Distrib::getStamp()) and must then be
+  /// rebuilt by calling update(). StatServer refuses to compute
+  /// likelihoods with an out of date object.
+  ///
+  /// @version 3.0
+  /// @date 2026
+
+  class ALIZE_API MixtureGDPacked : public Object
+  {
+
+  public :
+
+    /// Builds the compiled form of a mixture
+    /// @param m the mixture. It must not be deleted before this object.
+    ///
+    explicit MixtureGDPacked(const MixtureGD& m);
+
+    virtual ~MixtureGDPacked();
+
+    /// Returns the source mixture
+    /// @return the source mixture
+    ///
+    const MixtureGD& getMixture() const;
+
+    /// Tests whether the compiled form matches the source mixture.
+    /// Usually runs in constant time. When the mixture or one of its
+    /// distributions may have been modified, the content of the source
+    /// mixture is compared to the compiled form.
+    /// @return true if the compiled form matches the source mixture
+    ///
+    bool isUpToDate() const;
+
+    /// Rebuilds the compiled form if it is out of date
+    /// @return true if the compiled form has been rebuilt
+    ///
+    bool update();
+
+    /// Returns the number of distributions
+    /// @return the number of distributions
+    ///
+    unsigned long getDistribCount() const;
+
+    /// Returns the dimension of the distributions
+    /// @return the dimension of the distributions
+    ///
+    unsigned long getVectSize() const;
+
+    /// Returns the distance (in number of values) between the first
+    /// values of two consecutive rows of the matrices. Always a multiple
+    /// of 8 greater than or equal to the dimension.
+    /// @return the distance between two rows
+    ///
+    unsigned long getStride() const;
+
+    /// Returns the mean matrix. Row c starts at index c*getStride().
+    /// @return a pointer on the first value of the matrix
+    ///
+    const real_t* getMeanMatrix() const;
+
+    /// Returns the inverse covariance matrix. Row c starts at index
+    /// c*getStride().
+    /// @return a pointer on the first value of the matrix
+    ///
+    const real_t* getCovInvMatrix() const;
+
+    /// Returns the weights of the distributions
+    /// @return a pointer on the first weight
+    ///
+    const weight_t* getWeightVect() const;
+
+    /// Returns the constants of the distributions
+    /// @return a pointer on the first constant
+    ///
+    const real_t* getCstVect() const;
+
+    /// Returns the logarithms of the weights of the distributions. A null
+    /// weight gives log(EPS_LK).
+    /// @return a pointer on the first log-weight
+    ///
+    const real_t* getLogWeightVect() const;
+
+    /// Returns the logarithms of the constants of the distributions
+    /// @return a pointer on the first log-constant
+    ///
+    const real_t* getLogCstVect() const;
+
+    /// Returns log(weight*constant) for each distribution. Used by the
+    /// log-domain likelihood computation.
+    /// @return a pointer on the first value
+    ///
+    const real_t* getLogWeightCstVect() const;
+
+    /// Returns the matrix used to compute log-likelihoods with a matrix
+    /// product. For a feature x, log(w[c]*lk(c, x)) is equal to
+    /// getGemmCstVect()[c] + z.g where g is the row c of the matrix and
+    /// z = (x[0]^2, ..., x[n-1]^2, 0..., x[0], ..., x[n-1], 0...). The
+    /// row is made of -0.5*covInv and mean*covInv, each padded to
+    /// getStride() values.
+    /// @return a pointer on the first value of the matrix. Row c starts
+    ///      at index 2*c*getStride().
+    ///
+    const real_t* getGemmMatrix() const;
+
+    /// Returns the constant terms associated with getGemmMatrix() :
+    /// log(weight*cst) - 0.5 * sum of mean^2*covInv
+    /// @return a pointer on the first value
+    ///
+    const real_t* getGemmCstVect() const;
+
+    /// Returns the distance (in number of values) between two rows of the
+    /// single precision matrices. Always a multiple of 16.
+    /// @return the distance between two rows
+    ///
+    unsigned long getFloatStride() const;
+
+    /// Returns the single precision copy of the mean matrix. Row c starts
+    /// at index c*getFloatStride().
+    /// @return a pointer on the first value of the matrix
+    ///
+    const float* getFloatMeanMatrix() const;
+
+    /// Returns the single precision copy of the inverse covariance
+    /// matrix. Row c starts at index c*getFloatStride().
+    /// @return a pointer on the first value of the matrix
+    ///
+    const float* getFloatCovInvMatrix() const;
+
+    virtual String getClassName() const;
+    virtual String toString() const;
+
+  private :
+
+    const MixtureGD*  _pMixture;
+    unsigned long     _distribCount;
+    unsigned long     _vectSize;
+    unsigned long     _stride;
+    unsigned long     _floatStride;
+    mutable unsigned long _stamp; /*!< stamp of the last check */
+    real_t*           _pBuffer;   /*!< allocated memory */
+    real_t*           _meanMatr;
+    real_t*           _covInvMatr;
+    real_t*           _gemmMatr;
+    float*            _pFloatBuffer; /*!< allocated memory */
+    float*            _floatMeanMatr;
+    float*            _floatCovInvMatr;
+    DoubleVector      _weightVect;
+    DoubleVector      _cstVect;
+    DoubleVector      _logWeightVect;
+    DoubleVector      _logCstVect;
+    DoubleVector      _logWeightCstVect;
+    DoubleVector      _gemmCstVect;
+
+    void build();
+    bool matchesMixture() const;
+
+    MixtureGDPacked(const MixtureGDPacked&); /*!Not implemented*/
+    const MixtureGDPacked& operator=(
+                       const MixtureGDPacked&); /*!Not implemented*/
+    bool operator==(const MixtureGDPacked&) const; /*!Not implemented*/
+    bool operator!=(const MixtureGDPacked&) const; /*!Not implemented*/
+  };
+
+} // end namespace alize
+
+#endif // !defined(ALIZE_MixtureGDPacked_h)
@@ -0,0 +1,209 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+
+#if !defined(ALIZE_MixtureGDPackedSet_h)
+#define ALIZE_MixtureGDPackedSet_h
+
+#if defined(_WIN32)
+#if defined(ALIZE_EXPORTS)
+#define ALIZE_API __declspec(dllexport)
+#else
+#define ALIZE_API __declspec(dllimport)
+#endif
+#else
+#define ALIZE_API
+#endif
+
+#include "Object.h"
+#include "RealVector.h"
+#include "RefVector.h"
+#include "ULongVector.h"
+
+namespace alize
+{
+  class MixtureGD;
+
+  /// Read-only compiled form of a list of MixtureGD objects with the same
+  /// number of distributions and the same dimension, typically target
+  /// models adapted from a single world model. Used by
+  /// StatServer::computeMeanLLK() to score many models on the top
+  /// distributions of the world model.\n
+  /// The parameters of all the mixtures are stored in a single matrix.
+  /// The row of the distribution c of the mixture i holds the mean vector
+  /// followed by the inverse covariance vector, each padded to
+  /// getStride() values.\n
+  /// Like MixtureGDPacked, the object keeps references to the source
+  /// mixtures and must be refreshed by calling update() when one of them
+  /// has been modified.
+  ///
+  /// @version 3.0
+  /// @date 2026
+
+  class ALIZE_API MixtureGDPackedSet : public Object
+  {
+
+  public :
+
+    /// Creates an empty set
+    ///
+    MixtureGDPackedSet();
+
+    virtual ~MixtureGDPackedSet();
+
+    /// Appends the compiled form of a mixture
+    /// @param m the mixture. It must not be deleted before this object.
+    /// @return the index of the mixture in the set
+    /// @exception Exception if the number of distributions or the
+    ///      dimension of the mixture do not match the first mixture
+    ///
+    unsigned long addMixture(const MixtureGD& m);
+
+    /// Removes all the mixtures. Does not free memory.
+    ///
+    void clear();
+
+    /// Returns the number of mixtures
+    /// @return the number of mixtures
+    ///
+    unsigned long getMixtureCount() const;
+
+    /// Returns a source mixture
+    /// @param i index of the mixture in the set
+    /// @return the mixture
+    /// @exception IndexOutOfBoundsException
+    ///
+    const MixtureGD& getMixture(unsigned long i) const;
+
+    /// Tests whether the compiled forms match the source mixtures. Usually
+    /// runs in constant time.
+    /// @return true if no mixture and no distribution have been modified
+    ///      since the mixtures were compiled
+    ///
+    bool isUpToDate() const;
+
+    /// Compiles again the mixtures that have been modified
+    /// @return true if at least one mixture has been compiled again
+    /// @exception Exception if the number of distributions or the
+    ///      dimension of a mixture has changed
+    ///
+    bool update();
+
+    /// Returns the number of distributions of each mixture
+    /// @return the number of distributions
+    ///
+    unsigned long getDistribCount() const;
+
+    /// Returns the dimension of the distributions
+    /// @return the dimension of the distributions
+    ///
+    unsigned long getVectSize() const;
+
+    /// Returns the distance (in number of values) between the mean vector
+    /// and the inverse covariance vector of a distribution. Always a
+    /// multiple of 8 greater than or equal to the dimension.
+    /// @return the stride
+    ///
+    unsigned long getStride() const;
+
+    /// Returns the parameters matrix. The mean vector of the distribution
+    /// c of the mixture i starts at index 2*(i*getDistribCount()+c)*
+    /// getStride(), the inverse covariance vector getStride() values
+    /// later.
+    /// @return a pointer on the first value of the matrix
+    ///
+    const real_t* getParamMatrix() const;
+
+    /// Returns the weights of the distributions. The weight of the
+    /// distribution c of the mixture i is at index i*getDistribCount()+c.
+    /// @return a pointer on the first weight
+    ///
+    const weight_t* getWeightVect() const;
+
+    /// Returns the constants of the distributions, stored like the
+    /// weights
+    /// @return a pointer on the first constant
+    ///
+    const real_t* getCstVect() const;
+
+    virtual String getClassName() const;
+    virtual String toString() const;
+
+  private :
+
+    RefVector<const MixtureGD> _mixtureVect;
+    unsigned long     _distribCount;
+    unsigned long     _vectSize;
+    unsigned long     _stride;
+    unsigned long     _capacity; /*!< number of mixtures */
+    mutable unsigned long _stamp; /*!< stamp of the last check */
+    ULongVector       _stampVect; /*!< stamps of the compilations */
+    real_t*           _pBuffer;  /*!< allocated memory */
+    real_t*           _paramMatr;
+    DoubleVector      _weightVect;
+    DoubleVector      _cstVect;
+
+    void pack(unsigned long i);
+    bool isModified(unsigned long i) const;
+
+    MixtureGDPackedSet(const MixtureGDPackedSet&); /*!Not implemented*/
+    const MixtureGDPackedSet& operator=(
+                       const MixtureGDPackedSet&); /*!Not implemented*/
+    bool operator==(const MixtureGDPackedSet&) const; /*!Not implemented*/
+    bool operator!=(const MixtureGDPackedSet&) const; /*!Not implemented*/
+  };
+
+} // end namespace alize
+
+#endif // !defined(ALIZE_MixtureGDPackedSet_h)
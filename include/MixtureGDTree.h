@@ -0,0 +1,243 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+
+#if !defined(ALIZE_MixtureGDTree_h)
+#define ALIZE_MixtureGDTree_h
+
+#if defined(_WIN32)
+#if defined(ALIZE_EXPORTS)
+#define ALIZE_API __declspec(dllexport)
+#else
+#define ALIZE_API __declspec(dllimport)
+#endif
+#else
+#define ALIZE_API
+#endif
+
+#include "Object.h"
+#include "RealVector.h"
+#include "ULongVector.h"
+#include "alizeString.h"
+
+namespace alize
+{
+  class MixtureGD;
+  class Feature;
+  class FeatureBlock;
+  class LKVector;
+
+  /// Preselection index of a MixtureGD object, used to determine the top
+  /// distributions of a feature without computing the likelihoods of all
+  /// the distributions.\n
+  /// The distributions are grouped into clusters by a k-means on their
+  /// mean vectors (the distance is weighted by the average inverse
+  /// covariance). Each cluster is represented by a parent gaussian with
+  /// the mean and the variance of its members. For a feature, the
+  /// likelihoods of all the parents are computed first, then only the
+  /// members of the 'beam' best clusters are computed.\n
+  /// The tree has two levels : parents and distributions. A distribution
+  /// belongs to a single cluster.\n
+  /// Like MixtureGDPacked, the object keeps a reference to the source
+  /// mixture and must be rebuilt by calling update() when the mixture has
+  /// been modified.
+  ///
+  /// @version 3.0
+  /// @date 2026
+
+  class ALIZE_API MixtureGDTree : public Object
+  {
+
+  public :
+
+    /// Builds the index of a mixture
+    /// @param m the mixture. It must not be deleted before this object.
+    /// @param clusterCount number of clusters. Set to the number of
+    ///      distributions if greater.
+    /// @param iterationCount maximum number of k-means iterations
+    /// @exception Exception if clusterCount is 0
+    ///
+    MixtureGDTree(const MixtureGD& m, unsigned long clusterCount,
+                  unsigned long iterationCount = 10);
+
+    virtual ~MixtureGDTree();
+
+    /// Returns the source mixture
+    /// @return the source mixture
+    ///
+    const MixtureGD& getMixture() const;
+
+    /// Returns the identifier and the number of distributions of the
+    /// mixture when the index was last built. Unlike getMixture(), these
+    /// can be read after the mixture has been deleted.
+    /// @return the identifier of the mixture
+    ///
+    const String& getMixtureId() const;
+
+    /// @return the number of distributions of the mixture
+    ///
+    unsigned long getDistribCount() const;
+
+    /// Tests whether the index has been built from the current state of
+    /// the source mixture. Usually runs in constant time.
+    /// @return true if neither the mixture nor its distributions have been
+    ///      modified since the index was built
+    ///
+    bool isUpToDate() const;
+
+    /// Rebuilds the index if it is out of date
+    /// @return true if the index has been rebuilt
+    ///
+    bool update();
+
+    /// Returns the number of clusters
+    /// @return the number of clusters
+    ///
+    unsigned long getClusterCount() const;
+
+    /// Returns the number of distributions of a cluster
+    /// @param k index of the cluster
+    /// @return the number of distributions
+    /// @exception IndexOutOfBoundsException
+    ///
+    unsigned long getMemberCount(unsigned long k) const;
+
+    /// Returns the indexes of the distributions of a cluster
+    /// @param k index of the cluster
+    /// @return a pointer on the first index. getMemberCount(k) indexes
+    ///      are stored contiguously.
+    /// @exception IndexOutOfBoundsException
+    ///
+    const unsigned long* getMemberArray(unsigned long k) const;
+
+    /// Computes the log-likelihoods of the parents for a feature and
+    /// selects the best clusters
+    /// @param f the feature
+    /// @param beam the number of clusters to select
+    /// @param clusterLkVect to store the log-likelihoods of the parents.
+    ///      Its size is set to the number of clusters. The 'beam' best
+    ///      clusters are moved to the beginning (see
+    ///      LKVector::descendingPartialSort()).
+    ///
+    void selectClusters(const Feature& f, unsigned long beam,
+                        LKVector& clusterLkVect) const;
+
+    /// Determines the top distributions of a feature. Only the
+    /// distributions of the 'beam' best clusters are computed.
+    /// @param f the feature
+    /// @param beam the number of clusters to expand
+    /// @param nTop the number of top distributions
+    /// @param lkVect to store the weighted likelihoods of the
+    ///      distributions. Its size is set to the number of distributions.
+    ///      The computed distributions come first, the nTop best ones
+    ///      sorted at the beginning (see LKVector::descendingPartialSort()).
+    ///      The other distributions follow with a null likelihood.
+    /// @param clusterLkVect scratch vector for selectClusters()
+    /// @return the number of computed distributions
+    ///
+    unsigned long computeTopDistribs(const Feature& f, unsigned long beam,
+                                     unsigned long nTop, LKVector& lkVect,
+                                     LKVector& clusterLkVect) const;
+
+    /// Measures the quality of the preselection : for each feature of a
+    /// block, compares the nTop distributions found by
+    /// computeTopDistribs() to those found by computing all the
+    /// distributions.
+    /// @param b the block of features
+    /// @param beam the number of clusters to expand
+    /// @param nTop the number of top distributions
+    /// @param recall to store the average proportion of the exact top
+    ///      distributions that are found
+    /// @param computedRatio to store the average proportion of the
+    ///      distributions that are computed
+    /// @exception Exception if the block vectSize does not match the
+    ///      mixture vectSize
+    ///
+    void computeRecall(const FeatureBlock& b, unsigned long beam,
+                       unsigned long nTop, real_t& recall,
+                       real_t& computedRatio) const;
+
+    virtual String getClassName() const;
+    virtual String toString() const;
+
+  private :
+
+    const MixtureGD*  _pMixture;
+    String            _mixtureId;
+    unsigned long     _clusterCount;     /*!< requested number */
+    unsigned long     _iterationCount;
+    unsigned long     _distribCount;
+    unsigned long     _vectSize;
+    mutable unsigned long _stamp; /*!< stamp of the last check */
+    DoubleVector      _parentMeanVect;   /*!< one row per cluster */
+    DoubleVector      _parentCovInvVect; /*!< one row per cluster */
+    DoubleVector      _parentLogCstVect;
+    ULongVector       _memberVect;  /*!< distribs grouped by cluster */
+    ULongVector       _firstMemberVect; /*!< clusterCount+1 offsets */
+
+    void build();
+    unsigned long assign(const real_t* meanMatr, const real_t* centerMatr,
+                         unsigned long k, const real_t* scaleVect,
+                         ULongVector& clusterVect,
+                         DoubleVector& distVect) const;
+
+    MixtureGDTree(const MixtureGDTree&); /*!Not implemented*/
+    const MixtureGDTree& operator=(const MixtureGDTree&); /*!Not implemented*/
+    bool operator==(const MixtureGDTree&) const; /*!Not implemented*/
+    bool operator!=(const MixtureGDTree&) const; /*!Not implemented*/
+  };
+
+} // end namespace alize
+
+#endif // !defined(ALIZE_MixtureGDTree_h)
@@ -77,6 +77,7 @@
 namespace alize
 {
   class XLine;
+  class TaskPool;
 
   /// Class used to store and manage Mixture and Distrib objects.
   /// This class is responsible for creating and deleting these objects.
@@ -410,7 +411,9 @@ namespace alize
     ///
     void loadMixture(Mixture& m, const FileName& f);
 
-    /// Loads mixtures from a list of single mixture file
+    /// Loads mixtures from a list of single mixture file. The files are
+    /// read by a pool of threads built with the parameter 'numThread'
+    /// (see loadMixture(const XLine&, TaskPool&)).
     /// @param l the list of mixture file to read
     /// @return the index of the first mixture loaded in the server
     /// @exception IOException if an I/O error occurs
@@ -419,6 +422,23 @@ namespace alize
     ///
     unsigned long loadMixture(const XLine& l);
 
+    /// Loads mixtures from a list of single mixture file. The files are
+    /// read and the mixtures are built by the threads of a pool, then
+    /// the mixtures are added to the server in the order of the list :
+    /// the ids and the indices of the mixtures and the distributions do
+    /// not depend on the number of threads.\n
+    /// If a file cannot be loaded, the mixtures of the previous files of
+    /// the list stay in the server and the exception raised by this file
+    /// is thrown.
+    /// @param l the list of mixture file to read
+    /// @param p the pool of threads
+    /// @return the index of the first mixture loaded in the server
+    /// @exception IOException if an I/O error occurs
+    /// @exception FileNotFoundException
+    /// @exception InvalidDataException
+    ///
+    unsigned long loadMixture(const XLine& l, TaskPool& p);
+
     //-------------------------------------------------------------------
     
     /// Returns the number of distributions stored inside the server
@@ -493,6 +513,10 @@ namespace alize
     void addMixtureToDict(Mixture&);
     String newId();
     Mixture& loadMixture(const FileName& f, DistribType);
+    Mixture& readMixtureCopy(const FileName&) const;
+    Mixture& addLoadedMixture(Mixture&);
+
+    class LoadTask;
     void autoSetMixtureId(Mixture& m, String id);
 
 
@@ -0,0 +1,211 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+
+#if !defined(ALIZE_MixtureServerFileReaderBinary_h)
+#define ALIZE_MixtureServerFileReaderBinary_h
+
+#if defined(_WIN32)
+#if defined(ALIZE_EXPORTS)
+#define ALIZE_API __declspec(dllexport)
+#else
+#define ALIZE_API __declspec(dllimport)
+#endif
+#else
+#define ALIZE_API
+#endif
+
+#include "MixtureServerFileReaderAbstract.h"
+#include "alizeString.h"
+
+namespace alize
+{
+  class Mixture;
+  class MixtureGD;
+  class DistribGD;
+  class Config;
+
+  /// Reads a mixture server saved in the binary format (see
+  /// MixtureServerFileWriter and the parameter
+  /// 'saveMixtureServerFileFormat' = BINARY).\n
+  /// Format (native byte order, all the arrays start on a 64-byte
+  /// boundary) :\n
+  /// > header (128 bytes) : "ALIZEMSB", version (uint4 = 1), byte order
+  ///   mark (uint4 = 0x01020304), vectSize, stride, distribCount,
+  ///   mixtureCount, componentCount, hash table size, server name length,
+  ///   0 (uint4), then the offsets (uint8) of the arrays below\n
+  /// > means and inverse covariances of the distributions : two
+  ///   distribCount x stride matrices of doubles (stride = vectSize
+  ///   rounded up to a multiple of 8)\n
+  /// > determinant and constant of each distribution (doubles)\n
+  /// > for each mixture : index of its first component, number of
+  ///   components, offset and length of its id in the string pool (uint4)\n
+  /// > for each component : index of the distribution (uint4), then the
+  ///   weights of all the components (doubles)\n
+  /// > id index : hash table (FNV-1a, linear probing) giving the index of
+  ///   the mixture with a given id (uint4, 0xFFFFFFFF if empty)\n
+  /// > string pool : server name followed by the mixture ids\n
+  /// The file is mapped in memory (read only) when the system allows it
+  /// (see FileReader::map()) : opening a server only reads the header,
+  /// and the mixtures can be loaded one by one by id (see
+  /// readMixture()). Pages are shared by all the processes reading the
+  /// same file.
+  ///
+  /// @version 3.0
+  /// @date 2026
+
+  class ALIZE_API MixtureServerFileReaderBinary
+                         : public MixtureServerFileReaderAbstract
+  {
+
+  public :
+
+    explicit MixtureServerFileReaderBinary(const FileName&, const Config&);
+    static MixtureServerFileReaderBinary& create(const FileName&,
+                                                 const Config&);
+    virtual ~MixtureServerFileReaderBinary();
+
+    /// Reads the whole server
+    /// @param ms the MixtureServer object used to store the data
+    /// @exception FileNotFoundException
+    /// @exception InvalidDataException
+    /// @exception IOException if an I/O error occurs
+    ///
+    virtual void readMixtureServer(MixtureServer& ms);
+
+    /// Returns the number of mixtures in the file
+    /// @return the number of mixtures
+    /// @exception InvalidDataException
+    ///
+    unsigned long getMixtureCount();
+
+    /// Looks for a mixture in the id index of the file
+    /// @param id the id of the mixture
+    /// @return the index of the mixture in the file; -1 if not found
+    /// @exception InvalidDataException
+    ///
+    long getMixtureIndex(const String& id);
+
+    /// Loads a mixture of the file in a server. The distributions of the
+    /// mixture already loaded in this server by this reader are shared,
+    /// the other ones are created.
+    /// @param ms the server
+    /// @param id the id of the mixture
+    /// @return the new mixture
+    /// @exception Exception if the mixture is not in the file
+    /// @exception InvalidDataException
+    ///
+    MixtureGD& readMixture(MixtureServer& ms, const String& id);
+
+    /// Tests whether a file is in the binary format (starts with
+    /// "ALIZEMSB")
+    /// @param fullFileName the full name of the file
+    /// @return true if the file is in the binary format; false if not or
+    ///      if the file cannot be read
+    ///
+    static bool isBinaryFile(const FileName& fullFileName);
+
+    /// Returns the hash code of a mixture id in the id index (FNV-1a)
+    /// @param id the id
+    /// @return the hash code
+    ///
+    static unsigned long hashId(const String& id);
+
+    virtual String getClassName() const;
+
+  private :
+
+    const char*    _pData;     /*!< mapping or copy of the file */
+    char*          _pOwnedData; /*!< copy of the file if not mapped */
+    unsigned long  _vectSize;
+    unsigned long  _stride;
+    unsigned long  _distribCount;
+    unsigned long  _mixtureCount;
+    unsigned long  _componentCount;
+    unsigned long  _hashTableSize;
+    unsigned long  _serverNameLength;
+    const double*  _meanMatr;
+    const double*  _covInvMatr;
+    const double*  _detCstVect;
+    const unsigned char* _pMixtureRecords;
+    const unsigned char* _pDictIdxVect;
+    const double*  _weightVect;
+    const unsigned char* _pHashTable;
+    const char*    _pStringPool;
+    unsigned long  _stringPoolLength;
+    // distributions loaded by readMixture()
+    MixtureServer* _pLoadedServer;
+    DistribGD**    _loadedDistribs;
+    unsigned long* _loadedDictIdx;
+
+    void open(bool sequential);
+    unsigned long getUInt4(const unsigned char* p, unsigned long i) const;
+    DistribGD& loadDistrib(MixtureServer& ms, unsigned long idx);
+    MixtureGD& loadMixture(MixtureServer& ms, unsigned long idx,
+                           bool shareDistribs);
+    void error(const String& msg);
+
+    bool operator==(const MixtureServerFileReaderBinary&)
+                          const; /*!Not implemented*/
+    bool operator!=(const MixtureServerFileReaderBinary&)
+                          const; /*!Not implemented*/
+    const MixtureServerFileReaderBinary& operator=(
+           const MixtureServerFileReaderBinary&); /*!Not implemented*/
+    MixtureServerFileReaderBinary(
+           const MixtureServerFileReaderBinary&); /*!Not implemented*/
+  };
+
+} // end namespace alize
+
+#endif // !defined(ALIZE_MixtureServerFileReaderBinary_h)
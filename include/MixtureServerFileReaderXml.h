@@ -107,7 +107,6 @@ namespace alize
 
   private :
 
-    unsigned long  _line;
 
     unsigned long  _vectSize;
     bool       _vectSizeFound;
@@ -145,7 +144,6 @@ namespace alize
     DistribGD& getDistribGD();
     MixtureGF& getMixtureGF();
     DistribGF& getDistribGF();
-    virtual const String& readOneChar();
     virtual void eventOpeningElement(const String& path);
     virtual void eventClosingElement(const String& path,
                      const String& value);
@@ -65,6 +65,7 @@
 #define ALIZE_API
 #endif
 
+#include <stdint.h>
 #include "FileWriter.h"
 
 namespace alize
@@ -74,7 +75,8 @@ namespace alize
   class Config;
   class MixtureServer;
 
-  /// Convenient class used to save a mixture server in a raw or xml file 
+  /// Convenient class used to save a mixture server in a raw, xml or
+  /// binary file (see MixtureServerFileReaderBinary) 
   ///
   /// @author Frederic Wils  frederic.wils@lia.univ-avignon.fr
   /// @version 1.0
@@ -111,6 +113,9 @@ namespace alize
     void writeMixtureServerRaw(const MixtureServer&);
     void writeMixtureGDXml(const MixtureGD&);
     void writeMixtureGDRaw(const MixtureGD&);
+    void writeMixtureServerBinary(const MixtureServer&);
+    void writeBytes(const void*, unsigned long, uint64_t&);
+    void writePadding(uint64_t, uint64_t&);
     MixtureServerFileWriter(
              const MixtureServerFileWriter&); /*!Not implemented*/
     const MixtureServerFileWriter& operator=(
@@ -87,6 +87,7 @@ namespace alize
     friend class TestMixtureGFStat;
     friend class TestMixtureGDStat;
     friend class TestMixtureStat;
+    friend class MixtureStatFileReader;
   
   public :
 
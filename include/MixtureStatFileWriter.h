@@ -0,0 +1,137 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+
+#if !defined(ALIZE_MixtureStatFileWriter_h)
+#define ALIZE_MixtureStatFileWriter_h
+
+#if defined(_WIN32)
+#if defined(ALIZE_EXPORTS)
+#define ALIZE_API __declspec(dllexport)
+#else
+#define ALIZE_API __declspec(dllimport)
+#endif
+#else
+#define ALIZE_API
+#endif
+
+#include "FileWriter.h"
+
+namespace alize
+{
+  class Mixture;
+  class MixtureStat;
+
+  /// Writes the EM accumulators of a MixtureGDStat or a MixtureGFStat to
+  /// a binary file, so that the accumulation of an EM iteration can be
+  /// split into several jobs. See MixtureStatFileReader to sum the files
+  /// and compute the new model.\n
+  /// Format (native byte order) :\n
+  /// > "ALIZEACC", version (uint4 = 1), type (char 'D' or 'F'),
+  ///   distribCount (uint4), vectSize (uint4), model key (uint4)\n
+  /// > EM feature count, occupation feature count (doubles)\n
+  /// > accumulated occupation of each distribution (doubles)\n
+  /// > for each distribution : the vectSize accumulated means, then the
+  ///   vectSize (GD) or vectSize*vectSize (GF) accumulated second
+  ///   order moments (doubles)\n
+  /// The model key identifies the model being trained (see
+  /// computeModelKey()) : files computed from different models cannot be
+  /// summed.
+  ///
+  /// @version 3.0
+  /// @date 2026
+
+  class ALIZE_API MixtureStatFileWriter : public FileWriter
+  {
+
+  public :
+
+    /// @param f the name of the file
+    ///
+    explicit MixtureStatFileWriter(const FileName& f);
+
+    virtual ~MixtureStatFileWriter();
+
+    /// Writes the EM accumulators and closes the file
+    /// @param s the accumulators
+    /// @exception Exception if s is neither a MixtureGDStat nor a
+    ///      MixtureGFStat or if resetEM() has not been called
+    /// @exception IOException if an I/O error occurs
+    ///
+    void writeAccEM(MixtureStat& s);
+
+    /// Computes a 32-bit hash of the weights, the constants, the means and
+    /// the inverse covariances of a mixture. The key does not depend on
+    /// the byte order of the machine.
+    /// @param m the mixture
+    /// @return the key
+    ///
+    static unsigned long computeModelKey(const Mixture& m);
+
+    virtual String getClassName() const;
+
+  private :
+
+    void writeDoubles(const real_t* v, unsigned long n);
+
+    MixtureStatFileWriter(const MixtureStatFileWriter&); /*!Not implemented*/
+    const MixtureStatFileWriter& operator=(
+               const MixtureStatFileWriter&); /*!Not implemented*/
+    bool operator==(const MixtureStatFileWriter&) const; /*!Not implemented*/
+    bool operator!=(const MixtureStatFileWriter&) const; /*!Not implemented*/
+  };
+
+} // end namespace alize
+
+#endif // !defined(ALIZE_MixtureStatFileWriter_h)
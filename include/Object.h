@@ -143,6 +143,7 @@ namespace alize
     FeatureFileReaderFormat_SPRO3,
     FeatureFileReaderFormat_SPRO4,
     FeatureFileReaderFormat_HTK,
+    FeatureFileReaderFormat_COMPRESSED
   };
 
   enum MixtureFileReaderFormat
@@ -156,7 +157,14 @@ namespace alize
   {
     FeatureFileWriterFormat_SPRO3,
     FeatureFileWriterFormat_SPRO4,
-    FeatureFileWriterFormat_RAW
+    FeatureFileWriterFormat_RAW,
+    FeatureFileWriterFormat_COMPRESSED
+  };
+
+  enum FeatureFileCompression /* encoding of the COMPRESSED format */
+  {
+    FeatureFileCompression_FLOAT16, /* IEEE half precision */
+    FeatureFileCompression_INT16    /* int16 + scale and offset by dim */
   };
 
   enum SegServerFileReaderFormat
@@ -177,7 +185,8 @@ namespace alize
   enum MixtureServerFileWriterFormat
   {
     MixtureServerFileWriterFormat_XML,
-    MixtureServerFileWriterFormat_RAW
+    MixtureServerFileWriterFormat_RAW,
+    MixtureServerFileWriterFormat_BINARY
   };
 
   class ALIZE_API TopDistribsAction
@@ -246,6 +255,8 @@ namespace alize
              const String& name);
     static FeatureFileWriterFormat getFeatureFileWriterFormat(
              const String& name);
+    static FeatureFileCompression getFeatureFileCompression(
+             const String& name);
     static MixtureFileReaderFormat getMixtureFileReaderFormat(
              const String& name);
     static MixtureServerFileWriterFormat getMixtureServerFileWriterFormat(
@@ -265,6 +276,33 @@ namespace alize
 
     static unsigned long max(unsigned long, unsigned long);
 
+    /// Increments a counter shared by several threads
+    /// @param v the counter
+    /// @return the new value of the counter
+    ///
+    static unsigned long atomicIncrement(unsigned long& v);
+
+    /// Reads a value shared by several threads
+    /// @param v the value
+    /// @return the value
+    ///
+    static unsigned long atomicLoad(const unsigned long& v);
+
+    /// Writes a value shared by several threads
+    /// @param v the value
+    /// @param n the new value
+    ///
+    static void atomicStore(unsigned long& v, unsigned long n);
+
+    /// Replaces a value shared by several threads if it has not changed
+    /// @param v the value
+    /// @param old the expected value
+    /// @param n the new value
+    /// @return true if v was equal to old and has been replaced
+    ///
+    static bool atomicCompareAndSwap(unsigned long& v, unsigned long old,
+                                     unsigned long n);
+
 #if !defined NDEBUG
   public:
     /// @return the value of the created objects counter
@@ -369,6 +407,8 @@ namespace alize
     friend class FeatureFileReaderSingle;
     friend class FeatureInputStreamModifier;
     friend class FeatureServer;
+    friend class EMDriver;
+    friend class MixtureServerFileReaderBinary;
 
   private :
     K(){}; /*! private constructor */
@@ -0,0 +1,216 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+#if !defined(ALIZE_SimdKernels_h)
+#define ALIZE_SimdKernels_h
+
+#if defined(_WIN32)
+#if defined(ALIZE_EXPORTS)
+#define ALIZE_API __declspec(dllexport)
+#else
+#define ALIZE_API __declspec(dllimport)
+#endif
+#else
+#define ALIZE_API
+#endif
+
+#include "alizeString.h"
+
+namespace alize
+{
+  /// Vectorized kernels used for likelihood computation and file
+  /// decoding.\n
+  /// Several implementations are compiled in the library ("avx512",
+  /// "avx2", "sse2" and the portable "generic" one). The best one
+  /// supported by the processor is selected once at startup (CPUID).
+  /// The selection can be changed with setKernel(), for example to
+  /// compare results.
+  ///
+  /// @version 3.0
+  /// @date 2026
+
+  class ALIZE_API SimdKernels
+  {
+
+  public :
+
+    /// Computes sum for i in [0,n[ of (x[i]-m[i])^2 * c[i]
+    /// (quadratic form of a diagonal gaussian)
+    /// @param x the feature
+    /// @param m the mean vector
+    /// @param c the inverse covariance vector
+    /// @param n the dimension
+    /// @return the value of the quadratic form
+    ///
+    static real_t diagQuadForm(const real_t* x, const real_t* m,
+                               const real_t* c, unsigned long n);
+
+    /// Single precision version of diagQuadForm(). Twice as many values
+    /// are processed by each instruction.
+    ///
+    static float diagQuadForm(const float* x, const float* m,
+                              const float* c, unsigned long n);
+
+    /// Computes transpose(d) * c * d (quadratic form of a full
+    /// covariance gaussian)
+    /// @param d the difference between the feature and the mean
+    /// @param c the inverse covariance matrix (n*n values, row by row)
+    /// @param n the dimension
+    /// @return the value of the quadratic form
+    ///
+    static real_t fullQuadForm(const real_t* d, const real_t* c,
+                               unsigned long n);
+
+    /// Number of features processed by choleskyQuadFormVect()
+    ///
+    static const unsigned long CHOLESKY_BATCH_SIZE = 8;
+
+    /// Computes the quadratic forms of a full covariance gaussian for
+    /// CHOLESKY_BATCH_SIZE features with the Cholesky factor L of the
+    /// covariance matrix (cov = L*trans(L)) : solves L*y = x-m by forward
+    /// substitution and returns |y|^2 for each feature. The features are
+    /// solved together, so each value of the factor is read once and the
+    /// operations on the different features are independent.
+    /// @param x the first feature. The features are stored contiguously.
+    /// @param m the mean vector
+    /// @param l the factor, packed column by column. Column i holds n-i
+    ///      values : 1/L(i,i), L(i+1,i), ..., L(n-1,i)
+    /// @param n the dimension
+    /// @param r a scratch array of n*CHOLESKY_BATCH_SIZE values
+    /// @param q to store the CHOLESKY_BATCH_SIZE values of the quadratic
+    ///      form
+    ///
+    static void choleskyQuadFormVect(const real_t* x, const real_t* m,
+                       const real_t* l, unsigned long n, real_t* r,
+                       real_t* q);
+
+    /// Finds the first value greater than or equal to a threshold in a
+    /// strided array : the values are v[0], v[stride], v[2*stride]...
+    /// Used to skip quickly the values that cannot enter a top-N
+    /// selection.
+    /// @param v the first value
+    /// @param n the number of values
+    /// @param stride distance between two values
+    /// @param t the threshold
+    /// @return the index i (v[i*stride]) of the first value >= t, or n if
+    ///      none
+    ///
+    static unsigned long findGreaterOrEqual(const real_t* v,
+                         unsigned long n, unsigned long stride, real_t t);
+
+    /// Reverses the byte order of 8-byte values (in place). Used to
+    /// decode the files written on a machine with another byte order.
+    /// @param v the first value. Does not need to be aligned.
+    /// @param n the number of values
+    ///
+    static void swap8Bytes(void* v, unsigned long n);
+
+    /// Converts IEEE 754 half precision values (16 bits) to single
+    /// precision. The conversion is exact.
+    /// @param h the first half precision value
+    /// @param f to store the n single precision values
+    /// @param n the number of values
+    ///
+    static void halfToFloat(const unsigned short* h, float* f,
+                            unsigned long n);
+
+    /// Converts single precision values to IEEE 754 half precision
+    /// (rounding to nearest even). Values greater than 65504 in absolute
+    /// value become infinite.
+    /// @param f the first single precision value
+    /// @param h to store the n half precision values
+    /// @param n the number of values
+    ///
+    static void floatToHalf(const float* f, unsigned short* h,
+                            unsigned long n);
+
+    /// Decodes quantized vectors : f[t*n+i] = q[t*n+i]*scale[i] + offset[i]
+    /// @param q the first quantized value. The vectors are stored
+    ///      contiguously.
+    /// @param scale the scale of each dimension
+    /// @param offset the offset of each dimension
+    /// @param n the dimension of the vectors
+    /// @param count the number of vectors
+    /// @param f to store the n*count decoded values
+    ///
+    static void dequantize(const short* q, const float* scale,
+                           const float* offset, unsigned long n,
+                           unsigned long count, float* f);
+
+    /// Returns the name of the selected implementation
+    /// @return "avx512", "avx2", "sse2" or "generic"
+    ///
+    static String getKernelName();
+
+    /// Selects an implementation
+    /// @param name "avx512", "avx2", "sse2" or "generic"
+    /// @exception Exception if the implementation is unknown or is not
+    ///      supported by the processor
+    ///
+    static void setKernel(const String& name);
+
+    /// Tests whether an implementation is supported by the processor
+    /// @param name "avx512", "avx2", "sse2" or "generic"
+    /// @return true if the implementation can be selected
+    ///
+    static bool isKernelSupported(const String& name);
+
+  private :
+
+    SimdKernels(); /*!Not implemented*/
+  };
+
+} // end namespace alize
+
+#endif // !defined(ALIZE_SimdKernels_h)
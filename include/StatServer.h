@@ -93,9 +93,26 @@ namespace alize
   class MixtureGF;
   class MixtureGD;
   class MixtureStat;
+  class FeatureBlock;
+  class MixtureGDPacked;
+  class MixtureGDPackedSet;
+  class MixtureGDTree;
+  class FloatFeatureBlock;
+  class TaskPool;
 
   /// This class is used to compute all the statistics needed for models
   /// training and adapting algorithms as well as for decoding algorithms.
+  ///\n
+  /// A StatServer is a scoring context : it holds the MixtureStat
+  /// accumulators, the top distributions vector and the scratch vectors.
+  /// It must be used by one thread at a time. To score in parallel,
+  /// create one StatServer per thread. These servers can share the
+  /// Config, the MixtureServer and the compiled mixtures
+  /// (MixtureGDPacked, MixtureGDPackedSet) as long as no thread modifies
+  /// the mixtures or calls MixtureStat::resetEM() on a shared mixture
+  /// (it copies the mixture and changes the reference counters of its
+  /// distributions). EMDriver runs the EM accumulation of a mixture on
+  /// several threads.
   ///
   /// @author Frederic Wils  frederic.wils@lia.univ-avignon.fr
   /// @version 1.0
@@ -127,7 +144,15 @@ namespace alize
     ///
     void reset();
     
-    /// Computes log-likelihood between a mixture and a feature
+    /// Computes log-likelihood between a mixture and a feature.\n
+    /// If the parameter 'computeLLKInLogDomain' is true, the
+    /// log-likelihoods of the distributions (Distrib::computeLogLK()) are
+    /// combined with a log-sum-exp shifted by their maximum. It saves a
+    /// log() per feature and the result does not underflow to minLLK
+    /// for features far from all the distributions. This mode is used by
+    /// all the computeLLK() methods taking a Mixture or a
+    /// MixtureGDPacked, except computeLLK(m, f, idx). Methods using top
+    /// distributions stay in the linear domain.
     /// @param m the mixture
     /// @param f the feature
     /// @return the log-likelihood
@@ -143,16 +168,154 @@ namespace alize
     ///
     lk_t computeLLK(const Mixture& m, const Feature& f, unsigned long idx) const;
 
+    /// Computes log-likelihoods between a mixture and all the features of
+    /// a block. The features are processed by tiles : all the
+    /// distributions are computed for a tile before moving to the next
+    /// one so that the parameters of each distribution stay in cache
+    /// while they are used for many features.\n
+    /// For each feature, the likelihoods of the distributions are summed
+    /// in the same order as in computeLLK(m, f). Results match those of
+    /// computeLLK(m, f) with a relative difference lower than 1e-12
+    /// (depending on compiler optimizations).
+    /// @param m the mixture
+    /// @param b the block of features
+    /// @param llkVect vector to store the log-likelihoods. Its size is set
+    ///    to the number of features in the block.
+    /// @exception Exception if the dimension of the mixture is not
+    ///      equals to the dimension of the features
+    ///
+    void computeLLK(const Mixture& m, const FeatureBlock& b,
+                    DoubleVector& llkVect) const;
+
+    /// Computes log-likelihood between a compiled mixture and a feature.
+    /// Same result as computeLLK(p.getMixture(), f).
+    /// @param p the compiled mixture
+    /// @param f the feature
+    /// @return the log-likelihood
+    /// @exception Exception if the compiled mixture is out of date
+    /// @exception Exception if the dimension of the mixture is not
+    ///      equals to the dimension of the feature
+    ///
+    lk_t computeLLK(const MixtureGDPacked& p, const Feature& f) const;
+
+    /// Like computeLLK(const Mixture&, const FeatureBlock&, DoubleVector&)
+    /// but with a compiled mixture.
+    /// @param p the compiled mixture
+    /// @param b the block of features
+    /// @param llkVect vector to store the log-likelihoods. Its size is set
+    ///    to the number of features in the block.
+    /// @exception Exception if the compiled mixture is out of date
+    /// @exception Exception if the dimension of the mixture is not
+    ///      equals to the dimension of the features
+    ///
+    void computeLLK(const MixtureGDPacked& p, const FeatureBlock& b,
+                    DoubleVector& llkVect) const;
+
+    /// Single precision version of computeLLK(const MixtureGDPacked&,
+    /// const FeatureBlock&, DoubleVector&). The quadratic forms are
+    /// computed in single precision with the single precision parameters
+    /// of the compiled mixture. The rest of the computation is done in
+    /// double precision, always in the log domain.
+    /// @param p the compiled mixture
+    /// @param b the block of features
+    /// @param llkVect vector to store the log-likelihoods. Its size is set
+    ///    to the number of features in the block.
+    /// @exception Exception if the compiled mixture is out of date
+    /// @exception Exception if the dimension of the mixture is not
+    ///      equals to the dimension of the features
+    ///
+    void computeLLK(const MixtureGDPacked& p, const FloatFeatureBlock& b,
+                    DoubleVector& llkVect) const;
+
+    /// Computes the weighted log-likelihoods between all the
+    /// distributions of a compiled mixture and a range of features of a
+    /// block :\n
+    /// logLkMatr[t*distribCount+c] = log(w[c] * lk(c, feature first+t))\n
+    /// The quadratic form of each distribution is expanded
+    /// (x^2.covInv - 2x.mean.covInv + mean^2.covInv) so that all the
+    /// values are given by a single matrix product (see Gemm and
+    /// MixtureGDPacked::getGemmMatrix()). The expansion loses a few
+    /// digits compared with computeLLK() when features are far from
+    /// zero relatively to their variance.
+    /// @param p the compiled mixture
+    /// @param b the block of features
+    /// @param first index of the first feature to use in the block
+    /// @param count number of features to use
+    /// @param logLkMatr matrix to store the log-likelihoods (one row per
+    ///      feature). Its size is set to count*distribCount.
+    /// @exception Exception if the compiled mixture is out of date
+    /// @exception Exception if the dimension of the mixture is not
+    ///      equals to the dimension of the features
+    /// @exception IndexOutOfBoundsException
+    ///
+    void computeLogLKMatrix(const MixtureGDPacked& p, const FeatureBlock& b,
+                            unsigned long first, unsigned long count,
+                            DoubleVector& logLkMatr) const;
+
+    /// Like computeLLK(const MixtureGDPacked&, const FeatureBlock&,
+    /// DoubleVector&) but uses computeLogLKMatrix() and a log-sum-exp.
+    /// Much faster for large mixtures ; see computeLogLKMatrix() about
+    /// accuracy. Always computed in the log domain.
+    /// @param p the compiled mixture
+    /// @param b the block of features
+    /// @param llkVect vector to store the log-likelihoods. Its size is set
+    ///    to the number of features in the block.
+    /// @exception Exception if the compiled mixture is out of date
+    /// @exception Exception if the dimension of the mixture is not
+    ///      equals to the dimension of the features
+    ///
+    void computeLLKWithGemm(const MixtureGDPacked& p, const FeatureBlock& b,
+                            DoubleVector& llkVect) const;
+
+    /// Scores a block of features with a world model and a set of target
+    /// models adapted from it (same number of distributions). For each
+    /// feature, the top distributions are determined once with the world
+    /// model, like computeAndAccumulateLLK(world, f, DETERMINE_TOP_DISTRIBS),
+    /// then only these distributions are computed for every target model,
+    /// like computeAndAccumulateLLK(target, f, USE_TOP_DISTRIBS). The
+    /// results are the same but the features are read once and the
+    /// parameters of the targets come from a single matrix.\n
+    /// Nothing is accumulated in the MixtureStat objects of the server.
+    /// The top distributions of the last feature are left in
+    /// getTopDistribIndexVector().
+    /// @param world the world model
+    /// @param s the compiled target models
+    /// @param b the block of features
+    /// @param llkVect vector to store the mean log-likelihood of each
+    ///    target model. Its size is set to the number of models in s.
+    /// @return the mean log-likelihood of the world model
+    /// @exception Exception if s is out of date or if the dimensions do
+    ///      not match
+    ///
+    lk_t computeMeanLLK(const Mixture& world, const MixtureGDPackedSet& s,
+                        const FeatureBlock& b, DoubleVector& llkVect);
+
     /// Computes the log-likelihood between ALL the distributions of the
     /// server and the feature. The results are store in an array.\n
     /// That is useful when many distributions are shared by mixtures.
     /// The log-likelihood is just computed once for each distribution.
+    /// The distributions are shared out among the threads of the pool
+    /// (see setTaskPool()).
     /// @param f the feature
     ///
     void computeAllDistribLK(const Feature& f);
 
+    /// Sets the pool of threads used by computeAllDistribLK(). By default,
+    /// the server builds its own pool on the first call, with the
+    /// parameters 'numThread' and 'threadPinning'.
+    /// @param p the pool. It must not be deleted before this object.
+    ///
+    void setTaskPool(TaskPool& p);
+
     /// Returns the best distributions index vector defined after calling
-    /// computeAndAccumulateLLK(...)
+    /// computeAndAccumulateLLK(...). Only the first topDistribsCount
+    /// values are sorted (see LKVector::descendingPartialSort()).\n
+    /// If the parameters 'topDistribsTreeClusterCount' and
+    /// 'topDistribsTreeBeam' are set, the top distributions of a MixtureGD
+    /// are determined with a MixtureGDTree built on the first use of the
+    /// mixture : only the distributions of the 'topDistribsTreeBeam' best
+    /// clusters are computed. The other distributions follow them in the
+    /// vector with a null likelihood.
     /// @return the best distributions index vector
     /// 
     const LKVector& getTopDistribIndexVector() const;
@@ -459,10 +622,38 @@ namespace alize
     const Mixture*          _pLastMixture;
     MixtureStat*            _pLastMixtureStat;
     LKVector                _topDistribsVect; // For top distributions management
+    RefVector<MixtureGDTree> _topDistribsTreeVect;
+    LKVector                _clusterLKVect; // scratch for _topDistribsTreeVect
     const lk_t              _minLLK;
     const lk_t              _maxLLK;
+    const bool              _computeLLKInLogDomain;
+    TaskPool*               _pTaskPool;
+    bool                    _ownTaskPool;
 
     lk_t computeLLK(lk_t lk) const;
+    lk_t computeLLK(lk_t max, lk_t sum) const;
+    static void accumulateLK(const MixtureGDPacked&, const real_t* x,
+                             unsigned long featureCount, lk_t* lk);
+    static void accumulateLogLK(const MixtureGDPacked&, const real_t* x,
+                unsigned long featureCount, lk_t* maxVect, lk_t* sumVect);
+    static void accumulateLogLK(const MixtureGDPacked&, const float* x,
+                unsigned long featureCount, lk_t* maxVect, lk_t* sumVect);
+    static void computeLogLKMatrix(const MixtureGDPacked&, const real_t* x,
+                unsigned long featureCount, real_t* zMatr, lk_t* logLkMatr);
+
+    /// Returns the preselection index used to determine the top
+    /// distributions of a mixture. Builds it on the first call and
+    /// rebuilds it when the mixture has been modified.
+    /// @return NULL if the parameters of the index are not set or if the
+    ///      mixture is not a MixtureGD
+    ///
+    const MixtureGDTree* getTopDistribsTree(const Mixture& m);
+
+    /// Deletes the preselection indexes whose mixture has been replaced by
+    /// m or has been deleted from the mixture server
+    /// @param m the mixture an index is about to be built for
+    ///
+    void deleteDeadTopDistribsTrees(const Mixture& m);
 
     /// @param m
     ///
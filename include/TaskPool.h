@@ -0,0 +1,183 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+
+#if !defined(ALIZE_TaskPool_h)
+#define ALIZE_TaskPool_h
+
+#if defined(_WIN32)
+#if defined(ALIZE_EXPORTS)
+#define ALIZE_API __declspec(dllexport)
+#else
+#define ALIZE_API __declspec(dllimport)
+#endif
+#else
+#define ALIZE_API
+#endif
+
+#include "Object.h"
+
+namespace alize
+{
+  class Config;
+
+  /// A pool of threads used to run loops in parallel.\n
+  /// parallelFor() cuts a range of indices into one contiguous part per
+  /// thread. Each thread takes chunks of at most 'grain' indices from the
+  /// front of its own part. When its part is empty, it steals the second
+  /// half of the part of another thread, so that the work stays balanced
+  /// when the chunks do not all take the same time.\n
+  /// The calling thread takes part in the work. The other threads are
+  /// created by the constructor and wait between two calls.\n
+  /// The number of threads is given by the parameter 'numThread' (1 if
+  /// not set). When 'threadPinning' is true, the thread i created by the
+  /// pool (i >= 1) is bound to the processor i (Linux only). Without thread support
+  /// (THREAD not defined at compile time), the pool has one thread and the
+  /// loops run in the calling thread.\n
+  /// A pool can be shared by several objects and threads : when it is
+  /// already running a loop, parallelFor() runs the new loop in the
+  /// calling thread. This is also the case for a parallelFor() called
+  /// from a task.
+  ///
+  /// @version 3.0
+  /// @date 2026
+
+  class ALIZE_API TaskPool : public Object
+  {
+
+  public :
+
+    /// The body of a parallel loop
+    ///
+    class ALIZE_API Task
+    {
+    public :
+      virtual ~Task();
+
+      /// Processes the indices first to last-1. Must be thread-safe :
+      /// several chunks of the same loop run at the same time.
+      /// @param first the first index
+      /// @param last the index after the last one
+      /// @param threadIdx index of the thread, lower than
+      ///      getThreadCount(). Two chunks running at the same time in the
+      ///      same loop never have the same index : it can select a
+      ///      scratch buffer.
+      ///
+      virtual void run(unsigned long first, unsigned long last,
+                       unsigned long threadIdx) = 0;
+    };
+
+    /// Creates a pool
+    /// @param threadCount the number of threads, including the calling
+    ///      thread. Reduced to 1 without thread support.
+    /// @param pinning true to bind each thread to a processor
+    /// @exception Exception if threadCount is 0
+    ///
+    explicit TaskPool(unsigned long threadCount = 1, bool pinning = false);
+
+    /// Creates a pool with the parameters 'numThread' and 'threadPinning'
+    /// @param c the configuration
+    ///
+    explicit TaskPool(const Config& c);
+
+    virtual ~TaskPool();
+
+    /// Runs a task on the indices first to last-1 and waits for the end
+    /// of all the chunks.
+    /// @param first the first index
+    /// @param last the index after the last one
+    /// @param grain the maximum number of indices given to the task at
+    ///      once. 0 is read as 1. The loop runs in the calling thread
+    ///      when there are no more than 'grain' indices.
+    /// @param t the task
+    /// @exception Exception if the task has thrown an exception in one of
+    ///      the threads. The other chunks are processed.
+    ///
+    void parallelFor(unsigned long first, unsigned long last,
+                     unsigned long grain, Task& t);
+
+    /// Returns the number of threads, including the calling thread
+    /// @return the number of threads
+    ///
+    unsigned long getThreadCount() const;
+
+    /// Tests whether the threads are bound to processors
+    /// @return true if the threads are bound to processors
+    ///
+    bool isPinned() const;
+
+    virtual String getClassName() const;
+    virtual String toString() const;
+
+  private :
+
+    struct State;
+
+    State*        _pState; /*!< NULL without threads */
+    unsigned long _threadCount;
+    bool          _pinning;
+
+    void start();
+    void work(unsigned long threadIdx);
+    static void* threadMain(void*);
+
+    TaskPool(const TaskPool&); /*!Not implemented*/
+    const TaskPool& operator=(const TaskPool&); /*!Not implemented*/
+    bool operator==(const TaskPool&) const; /*!Not implemented*/
+    bool operator!=(const TaskPool&) const; /*!Not implemented*/
+  };
+
+} // end namespace alize
+
+#endif // !defined(ALIZE_TaskPool_h)
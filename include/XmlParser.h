@@ -66,10 +66,17 @@
 #endif
 
 #include "Object.h"
+#include "alizeString.h"
 
 namespace alize
 {
-  /// Abstract class to parse XML data. *** INTERNAL USAGE ***
+  class FileReader;
+
+  /// Abstract class to parse XML data. *** INTERNAL USAGE ***\n
+  /// The file is read through a buffer. The path and the value given to
+  /// the events are slices of internal character stacks copied into
+  /// reused String objects : parsing does not allocate memory for each
+  /// character or each element.
   ///
   /// @author Frederic Wils  frederic.wils@lia.univ-avignon.fr
   /// @version 1.0
@@ -85,8 +92,19 @@ namespace alize
 
   protected :
 
-    void parse();
-    virtual const String& readOneChar() = 0;
+    /// Parses the first element read from the current position of a file
+    /// @param r the reader of the file
+    /// @exception EOFException if the end of the file is reached before
+    ///      the end of the element
+    /// @exception IOException if an I/O error occurs
+    ///
+    void parse(FileReader& r);
+
+    /// Returns the number of the current line of the file (from 1)
+    /// @return the line number
+    ///
+    unsigned long getLine() const;
+
     virtual void eventOpeningElement(const String& path) = 0;
     virtual void eventClosingElement(const String& path,
                const String& value) = 0;
@@ -94,11 +112,34 @@ namespace alize
 
   private :
 
-    const String& readNextChar();
-    void test(bool, const String& msg);
-    void parseElement(String path, String s);
-    void parseAttribute(String path, String s);
-    bool isASeparator(String s) const;
+    FileReader*   _pXmlReader;
+    char*         _buffer;        /*!< characters read from the file */
+    unsigned long _bufferPos;
+    unsigned long _bufferEnd;
+    unsigned long _line;
+    char*         _pathArray;     /*!< stack of the tags of the path */
+    unsigned long _pathLength;
+    unsigned long _pathCapacity;
+    char*         _valueArray;    /*!< stack of the values */
+    unsigned long _valueLength;
+    unsigned long _valueCapacity;
+    String        _path;
+    String        _value;
+
+    char readOneChar();
+    char readNextChar();
+    void readText();
+    void fillBuffer();
+    void test(bool, const char* msg);
+    void parseElement(char c);
+    void parseAttribute(char c);
+    bool isASeparator(char c) const;
+    void pushPathChar(char c);
+    void pushValueChar(char c);
+    const String& currentPath();
+    const String& currentValue(unsigned long start);
+    static void reserve(char*& array, unsigned long& capacity,
+                        unsigned long length);
 
     bool operator==(const XmlParser&) const;    /*!Not implemented*/
     bool operator!=(const XmlParser&) const;    /*!Not implemented*/
@@ -63,6 +63,8 @@
 #include "Matrix.h"
 #include "BoolMatrix.h"
 #include "DoubleSquareMatrix.h"
+#include "Gemm.h"
+#include "SimdKernels.h"
 #include "ULongVector.h"
 #include "Config.h"
 #include "Label.h"
@@ -82,9 +84,16 @@
 #include "DistribGD.h"
 #include "DistribGF.h"
 #include "MixtureGD.h"
+#include "MixtureGDPacked.h"
+#include "MixtureGDPackedSet.h"
+#include "MixtureGDTree.h"
+#include "TaskPool.h"
+#include "EMDriver.h"
 #include "MixtureGF.h"
 #include "FeatureFlags.h"
 #include "Feature.h"
+#include "FeatureBlock.h"
+#include "FloatFeatureBlock.h"
 
 #include "LabelServer.h"
 #include "MixtureServer.h"
@@ -102,6 +111,7 @@
 #include "FeatureFileReaderSPro3.h"
 #include "FeatureFileReaderSPro4.h"
 #include "FeatureFileReaderHTK.h"
+#include "FeatureFileReaderCompressed.h"
 #include "FeatureFileReader.h"
 #include "FeatureInputStreamModifier.h"
 #include "MixtureFileReaderAmiral.h"
@@ -109,6 +119,8 @@
 #include "MixtureFileReaderXml.h"
 #include "MixtureFileReader.h"
 #include "MixtureFileWriter.h"
+#include "MixtureStatFileWriter.h"
+#include "MixtureStatFileReader.h"
 #include "MixtureServerFileWriter.h"
 #include "MixtureServerFileReader.h"
 #include "MixtureServerFileReaderXml.h"
@@ -156,6 +156,11 @@ namespace alize
     ///
     bool endsWith(const String&) const;
 
+    /// Same as endsWith(const String&) but does not build a temporary
+    /// String object from a literal suffix
+    ///
+    bool endsWith(const char*) const;
+
     /// Tests whether this string begins with the specified prefix
     /// @return true if the character sequence represented by the
     ///     argument is a prefix of the character sequence
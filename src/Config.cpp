@@ -125,6 +125,15 @@ void Config::assign(const Config& c) // private
   ASSIGN(_param_maxLLK);
   ASSIGN(_param_bigEndian);
   ASSIGN(_param_sampleRate);
+  ASSIGN(_param_computeLLKInLogDomain);
+  ASSIGN(_param_topDistribsTreeClusterCount);
+  ASSIGN(_param_topDistribsTreeBeam);
+  ASSIGN(_param_numThread);
+  ASSIGN(_param_threadPinning);
+  ASSIGN(_param_loadFeatureFileReadAhead);
+  ASSIGN(_param_loadFeatureFileMemoryMap);
+  ASSIGN(_param_saveFeatureFileCompression);
+  ASSIGN(_param_saveFeatureFileBackgroundFlush);
 
   ASSIGN(existsParam_minCov);
   ASSIGN(existsParam_vectSize);
@@ -173,6 +182,15 @@ void Config::assign(const Config& c) // private
   ASSIGN(existsParam_audioFilesPath);
   ASSIGN(existsParam_segServerFilesPath);
   ASSIGN(existsParam_mixtureFilesPath);
+  ASSIGN(existsParam_computeLLKInLogDomain);
+  ASSIGN(existsParam_topDistribsTreeClusterCount);
+  ASSIGN(existsParam_topDistribsTreeBeam);
+  ASSIGN(existsParam_numThread);
+  ASSIGN(existsParam_threadPinning);
+  ASSIGN(existsParam_loadFeatureFileReadAhead);
+  ASSIGN(existsParam_loadFeatureFileMemoryMap);
+  ASSIGN(existsParam_saveFeatureFileCompression);
+  ASSIGN(existsParam_saveFeatureFileBackgroundFlush);
   ASSIGN(_set);
 }
 //-------------------------------------------------------------------------
@@ -242,6 +260,15 @@ void Config::reset()
   existsParam_featureFilesPath = false;
   existsParam_audioFilesPath = false;
   existsParam_segServerFilesPath = false;
+  existsParam_computeLLKInLogDomain = false;
+  existsParam_topDistribsTreeClusterCount = false;
+  existsParam_topDistribsTreeBeam = false;
+  existsParam_numThread = false;
+  existsParam_threadPinning = false;
+  existsParam_loadFeatureFileReadAhead = false;
+  existsParam_loadFeatureFileMemoryMap = false;
+  existsParam_saveFeatureFileCompression = false;
+  existsParam_saveFeatureFileBackgroundFlush = false;
   _set.reset();
   setParam("debug", "false"); // always defined
 }
@@ -617,6 +644,78 @@ real_t Config::getParam_sampleRate() const
   return _param_sampleRate;
 }
 //-------------------------------------------------------------------------
+bool Config::getParam_computeLLKInLogDomain() const
+{
+  if (!existsParam_computeLLKInLogDomain)
+    throw ParamNotFoundInConfigException("computeLLKInLogDomain' in the config",
+                              __FILE__, __LINE__);
+  return _param_computeLLKInLogDomain;
+}
+//-------------------------------------------------------------------------
+unsigned long Config::getParam_topDistribsTreeClusterCount() const
+{
+  if (!existsParam_topDistribsTreeClusterCount)
+    throw ParamNotFoundInConfigException("topDistribsTreeClusterCount' in the config",
+                              __FILE__, __LINE__);
+  return _param_topDistribsTreeClusterCount;
+}
+//-------------------------------------------------------------------------
+unsigned long Config::getParam_topDistribsTreeBeam() const
+{
+  if (!existsParam_topDistribsTreeBeam)
+    throw ParamNotFoundInConfigException("topDistribsTreeBeam' in the config",
+                              __FILE__, __LINE__);
+  return _param_topDistribsTreeBeam;
+}
+//-------------------------------------------------------------------------
+unsigned long Config::getParam_numThread() const
+{
+  if (!existsParam_numThread)
+    throw ParamNotFoundInConfigException("numThread' in the config",
+                              __FILE__, __LINE__);
+  return _param_numThread;
+}
+//-------------------------------------------------------------------------
+bool Config::getParam_threadPinning() const
+{
+  if (!existsParam_threadPinning)
+    throw ParamNotFoundInConfigException("threadPinning' in the config",
+                              __FILE__, __LINE__);
+  return _param_threadPinning;
+}
+//-------------------------------------------------------------------------
+bool Config::getParam_loadFeatureFileReadAhead() const
+{
+  if (!existsParam_loadFeatureFileReadAhead)
+    throw ParamNotFoundInConfigException("loadFeatureFileReadAhead' in the config",
+                              __FILE__, __LINE__);
+  return _param_loadFeatureFileReadAhead;
+}
+//-------------------------------------------------------------------------
+bool Config::getParam_loadFeatureFileMemoryMap() const
+{
+  if (!existsParam_loadFeatureFileMemoryMap)
+    throw ParamNotFoundInConfigException("loadFeatureFileMemoryMap' in the config",
+                              __FILE__, __LINE__);
+  return _param_loadFeatureFileMemoryMap;
+}
+//-------------------------------------------------------------------------
+FeatureFileCompression Config::getParam_saveFeatureFileCompression() const
+{
+  if (!existsParam_saveFeatureFileCompression)
+    throw ParamNotFoundInConfigException("saveFeatureFileCompression' in the config",
+                              __FILE__, __LINE__);
+  return _param_saveFeatureFileCompression;
+}
+//-------------------------------------------------------------------------
+bool Config::getParam_saveFeatureFileBackgroundFlush() const
+{
+  if (!existsParam_saveFeatureFileBackgroundFlush)
+    throw ParamNotFoundInConfigException("saveFeatureFileBackgroundFlush' in the config",
+                              __FILE__, __LINE__);
+  return _param_saveFeatureFileBackgroundFlush;
+}
+//-------------------------------------------------------------------------
 void Config::setParam(const String& name, const String& content)
 {
   if (name == "minCov")
@@ -859,6 +958,60 @@ void Config::setParam(const String& name, const String& content)
     _param_segServerFilesPath = content;
     existsParam_segServerFilesPath = true;
   }
+  else if (name == "computeLLKInLogDomain")
+  {
+    _param_computeLLKInLogDomain = content.toBool();
+    existsParam_computeLLKInLogDomain = true;
+  }
+  else if (name == "topDistribsTreeClusterCount")
+  {
+    _param_topDistribsTreeClusterCount = content.toULong();
+    if (_param_topDistribsTreeClusterCount == 0)
+      throw Exception("parameter '"+name+"' cannot be 0",
+              __FILE__, __LINE__);
+    existsParam_topDistribsTreeClusterCount = true;
+  }
+  else if (name == "topDistribsTreeBeam")
+  {
+    _param_topDistribsTreeBeam = content.toULong();
+    if (_param_topDistribsTreeBeam == 0)
+      throw Exception("parameter '"+name+"' cannot be 0",
+              __FILE__, __LINE__);
+    existsParam_topDistribsTreeBeam = true;
+  }
+  else if (name == "numThread")
+  {
+    _param_numThread = content.toULong();
+    if (_param_numThread == 0)
+      throw Exception("parameter '"+name+"' cannot be 0",
+              __FILE__, __LINE__);
+    existsParam_numThread = true;
+  }
+  else if (name == "threadPinning")
+  {
+    _param_threadPinning = content.toBool();
+    existsParam_threadPinning = true;
+  }
+  else if (name == "loadFeatureFileReadAhead")
+  {
+    _param_loadFeatureFileReadAhead = content.toBool();
+    existsParam_loadFeatureFileReadAhead = true;
+  }
+  else if (name == "loadFeatureFileMemoryMap")
+  {
+    _param_loadFeatureFileMemoryMap = content.toBool();
+    existsParam_loadFeatureFileMemoryMap = true;
+  }
+  else if (name == "saveFeatureFileCompression")
+  {
+    _param_saveFeatureFileCompression = getFeatureFileCompression(content);
+    existsParam_saveFeatureFileCompression = true;
+  }
+  else if (name == "saveFeatureFileBackgroundFlush")
+  {
+    _param_saveFeatureFileBackgroundFlush = content.toBool();
+    existsParam_saveFeatureFileBackgroundFlush = true;
+  }
   else if (name == "debug")
   {
     if (content.getToken(0).isEmpty())
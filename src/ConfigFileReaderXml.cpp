@@ -72,9 +72,8 @@ void ConfigFileReaderXml::readConfig(Config& c)
 {
   _pConfig = &c;
   _pConfig->reset();
-  _line = 1;
-  parse();
   assert(_pReader != NULL);
+  parse(*_pReader);
   _pReader->close();
 }
 //-------------------------------------------------------------------------
@@ -135,19 +134,10 @@ void ConfigFileReaderXml::eventError(const String& msg)
 {
   assert(_pReader != NULL);
   _pReader->close();
-  throw InvalidDataException("Error line " + String::valueOf(_line)
+  throw InvalidDataException("Error line " + String::valueOf(getLine())
     + " : " + msg, __FILE__, __LINE__, _pReader->getFullFileName());
 }
 //-------------------------------------------------------------------------
-const String& ConfigFileReaderXml::readOneChar()
-{
-  assert(_pReader != NULL);
-  const String& s = _pReader->readString(1);
-  if (s == "\n")
-    _line++;
-  return s;
-}
-//-------------------------------------------------------------------------
 String ConfigFileReaderXml::getClassName() const
 { return "ConfigFileReaderXml"; }
 //-------------------------------------------------------------------------
@@ -59,14 +59,19 @@
 #include "DistribGD.h"
 #include "DistribGF.h"
 #include "Exception.h"
+#include "Feature.h"
+#include "FeatureBlock.h"
 
 using namespace alize;
 typedef Distrib D;
 
+unsigned long D::_lastStamp = 0;
+
 //-------------------------------------------------------------------------
 D::Distrib(unsigned long vectSize)
-:Object(), _vectSize(vectSize), _det(0.0), _cst(0.0),
- _meanVect(vectSize, vectSize), _refCounter(0), _dictIndex(0) {}
+:Object(), _vectSize(vectSize), _det(0.0), _cst(0.0), _logCst(0.0),
+ _meanVect(vectSize, vectSize), _refCounter(0), _dictIndex(0),
+ _stamp(newStamp(K::k)) {}
 //-------------------------------------------------------------------------
 bool D::operator!=(const Distrib& d) const { return !(*this == d); }
 //-------------------------------------------------------------------------
@@ -76,26 +81,93 @@ unsigned long D::getVectSize() const { return _vectSize; }
 //-------------------------------------------------------------------------
 real_t D::getMean(unsigned long i) const { return _meanVect[i]; }
 //-------------------------------------------------------------------------
-DoubleVector& D::getMeanVect() { return _meanVect; }
+DoubleVector& D::getMeanVect()
+{
+  updateStamp();
+  return _meanVect;
+}
 //-------------------------------------------------------------------------
 const DoubleVector& D::getMeanVect() const { return _meanVect; }
 //-------------------------------------------------------------------------
-void D::setMean(const real_t v, const unsigned long i){ _meanVect[i] = v; }
+void D::setMean(const real_t v, const unsigned long i)
+{
+  _meanVect[i] = v;
+  updateStamp();
+}
 //-------------------------------------------------------------------------
-void D::setMeanVect(const DoubleVector& v) { _meanVect.setValues(v); }
+void D::setMeanVect(const DoubleVector& v)
+{
+  _meanVect.setValues(v);
+  updateStamp();
+}
 //-------------------------------------------------------------------------
 real_t D::getDet() const { return _det; }
 //-------------------------------------------------------------------------
 real_t D::getCst() const { return _cst; }
 //-------------------------------------------------------------------------
-void D::setDet(const K&, real_t v) { _det = v; }
+void D::setDet(const K&, real_t v)
+{
+  _det = v;
+  updateStamp();
+}
 //-------------------------------------------------------------------------
-void D::setCst(const K&, real_t v) { _cst = v; }
+void D::setCst(const K&, real_t v)
+{
+  _cst = v;
+  _logCst = log(v);
+  updateStamp();
+}
 //-------------------------------------------------------------------------
 unsigned long& D::refCounter(const K&) { return _refCounter; }
 //-------------------------------------------------------------------------
 unsigned long& D::dictIndex(const K&) { return _dictIndex; }
 //-------------------------------------------------------------------------
+unsigned long D::getStamp() const { return _stamp; }
+//-------------------------------------------------------------------------
+unsigned long D::getLastStamp() { return atomicLoad(_lastStamp); }
+//-------------------------------------------------------------------------
+unsigned long D::newStamp(const K&) { return atomicIncrement(_lastStamp); }
+//-------------------------------------------------------------------------
+void D::updateStamp() { _stamp = newStamp(K::k); }
+//-------------------------------------------------------------------------
+void D::computeAndAccumulateLK(const FeatureBlock& b, unsigned long first,
+                      unsigned long count, weight_t w, lk_t* lkVect) const
+{
+  if (b.getVectSize() != _vectSize)
+    throw Exception("distrib vectSize ("
+        + String::valueOf(_vectSize) + ") != block vectSize ("
+        + String::valueOf(b.getVectSize()) + ")", __FILE__, __LINE__);
+  Feature f(_vectSize);
+  for (unsigned long i=first; i<first+count; i++)
+  {
+    b.getFeature(f, i);
+    lkVect[i] += w * computeLK(f);
+  }
+}
+//-------------------------------------------------------------------------
+lk_t D::computeLogLK(const Feature& f) const
+{
+  lk_t lk = computeLK(f);
+  if (lk < EPS_LK)
+    lk = EPS_LK;
+  return log(lk);
+}
+//-------------------------------------------------------------------------
+void D::computeLogLKVect(const FeatureBlock& b, unsigned long first,
+                         unsigned long count, lk_t* logLkVect) const
+{
+  if (b.getVectSize() != _vectSize)
+    throw Exception("distrib vectSize ("
+        + String::valueOf(_vectSize) + ") != block vectSize ("
+        + String::valueOf(b.getVectSize()) + ")", __FILE__, __LINE__);
+  Feature f(_vectSize);
+  for (unsigned long i=0; i<count; i++)
+  {
+    b.getFeature(f, first+i);
+    logLkVect[i] = computeLogLK(f);
+  }
+}
+//-------------------------------------------------------------------------
 D::~Distrib() {}
 //-------------------------------------------------------------------------
 Distrib& D::create(const K&, const DistribType type,
@@ -73,6 +73,8 @@
 #include "DistribGD.h"
 #include "alizeString.h"
 #include "Feature.h"
+#include "FeatureBlock.h"
+#include "SimdKernels.h"
 #include "Exception.h"
 #include "Config.h"
 
@@ -111,12 +113,23 @@ DistribGD& DistribGD::create(const K&, unsigned long vectSize)
 DistribGD& DistribGD::create(const K&, const Config& c)
 { return create(K::k, c.getParam_vectSize()); }
 //-------------------------------------------------------------------------
+DistribGD::DistribGD(const K&, unsigned long vectSize) // private
+:Distrib(vectSize), _covInvVect(_vectSize, _vectSize) {}
+//-------------------------------------------------------------------------
+DistribGD& DistribGD::createUninitialized(const K&, unsigned long vectSize)
+{
+  DistribGD* p = new (std::nothrow) DistribGD(K::k, vectSize);
+  assertMemoryIsAllocated(p, __FILE__, __LINE__);
+  return *p;
+}
+//-------------------------------------------------------------------------
 DistribGD::DistribGD(const DistribGD& d)
 :Distrib(d._vectSize), _covVect(d._covVect), _covInvVect(d._covInvVect)
 {
   _meanVect = d._meanVect;
   _det = d._det;
   _cst = d._cst;
+  _logCst = d._logCst;
 }
 //-------------------------------------------------------------------------
 const Distrib& DistribGD::operator=(const Distrib& d) // virtual
@@ -138,6 +151,8 @@ const DistribGD& DistribGD::operator=(const DistribGD& d)
   _covVect = d._covVect;
   _det = d._det;
   _cst = d._cst;
+  _logCst = d._logCst;
+  updateStamp();
   return *this;
 }
 //-------------------------------------------------------------------------
@@ -166,13 +181,10 @@ lk_t DistribGD::computeLK(const Feature& frame) const
     throw Exception("distrib vectSize ("
         + String::valueOf(_vectSize) + ") != feature vectSize ("
       + String::valueOf(frame.getVectSize()) + ")", __FILE__, __LINE__);
-  real_t tmp = 0.0;
   real_t*      m = _meanVect.getArray();
   real_t*      c = _covInvVect.getArray();
   Feature::data_t* f = frame.getDataVector();
-
-  for (unsigned long i=0; i<_vectSize; i++)
-    tmp += (f[i] - m[i]) * (f[i] - m[i]) * c[i];
+  real_t tmp = SimdKernels::diagQuadForm(f, m, c, _vectSize);
 
   tmp = _cst * exp(-0.5*tmp);
   if (ISNAN(tmp))
@@ -189,6 +201,64 @@ lk_t DistribGD::computeLK(const Feature& frame, unsigned long i) const
   return tmp;
 }
 //-------------------------------------------------------------------------
+void DistribGD::computeAndAccumulateLK(const FeatureBlock& b,
+    unsigned long first, unsigned long count, weight_t w, lk_t* lkVect) const
+{
+  if (b.getVectSize() != _vectSize)
+    throw Exception("distrib vectSize ("
+        + String::valueOf(_vectSize) + ") != block vectSize ("
+      + String::valueOf(b.getVectSize()) + ")", __FILE__, __LINE__);
+  if (count == 0)
+    return;
+  assertIsInBounds(__FILE__, __LINE__, first+count-1, b.getFeatureCount());
+  real_t*      m = _meanVect.getArray();
+  real_t*      c = _covInvVect.getArray();
+  const FeatureBlock::data_t* f = b.getFeatureVector(first);
+
+  for (unsigned long t=first; t<first+count; t++, f+=_vectSize)
+  {
+    real_t tmp = SimdKernels::diagQuadForm(f, m, c, _vectSize);
+    tmp = _cst * exp(-0.5*tmp);
+    if (ISNAN(tmp))
+      tmp = EPS_LK;
+    lkVect[t] += w * tmp;
+  }
+}
+//-------------------------------------------------------------------------
+lk_t DistribGD::computeLogLK(const Feature& frame) const
+{
+  if (frame.getVectSize() != _vectSize)
+    throw Exception("distrib vectSize ("
+        + String::valueOf(_vectSize) + ") != feature vectSize ("
+      + String::valueOf(frame.getVectSize()) + ")", __FILE__, __LINE__);
+  real_t*      m = _meanVect.getArray();
+  real_t*      c = _covInvVect.getArray();
+  Feature::data_t* f = frame.getDataVector();
+  real_t tmp = SimdKernels::diagQuadForm(f, m, c, _vectSize);
+  return _logCst - 0.5*tmp;
+}
+//-------------------------------------------------------------------------
+void DistribGD::computeLogLKVect(const FeatureBlock& b, unsigned long first,
+                                 unsigned long count, lk_t* logLkVect) const
+{
+  if (b.getVectSize() != _vectSize)
+    throw Exception("distrib vectSize ("
+        + String::valueOf(_vectSize) + ") != block vectSize ("
+      + String::valueOf(b.getVectSize()) + ")", __FILE__, __LINE__);
+  if (count == 0)
+    return;
+  assertIsInBounds(__FILE__, __LINE__, first+count-1, b.getFeatureCount());
+  real_t*      m = _meanVect.getArray();
+  real_t*      c = _covInvVect.getArray();
+  const FeatureBlock::data_t* f = b.getFeatureVector(first);
+
+  for (unsigned long t=0; t<count; t++, f+=_vectSize)
+  {
+    real_t tmp = SimdKernels::diagQuadForm(f, m, c, _vectSize);
+    logLkVect[t] = _logCst - 0.5*tmp;
+  }
+}
+//-------------------------------------------------------------------------
 void DistribGD::computeAll()
 {
   real_t* vect = getCovVect().getArray();
@@ -217,9 +287,11 @@ void DistribGD::computeAll()
     _cst = 1.0 / ( pow(_det, 0.5) * pow( PI2 , _vectSize/2.0 ) );
   else
     _cst = 1.0 / ( pow(EPS_LK, 0.5) * pow( PI2 , _vectSize/2.0 ) );
+  _logCst = log(_cst);
 
   //
   _covVect.setSize(0, true); // set capacity to 0 too
+  updateStamp();
 }
 //-------------------------------------------------------------------------
 void DistribGD::setCov(real_t v, unsigned long i)
@@ -231,7 +303,10 @@ void DistribGD::setCov(real_t v, unsigned long i)
 }
 //-------------------------------------------------------------------------
 void DistribGD::setCovInv(const K&, real_t v, unsigned long i)
-{ _covInvVect[i] = v; }
+{
+  _covInvVect[i] = v;
+  updateStamp();
+}
 //-------------------------------------------------------------------------
 real_t DistribGD::getCov(unsigned long i)
 { return getCovVect()[i];}
@@ -241,10 +316,20 @@ real_t DistribGD::getCov(unsigned long i) const
 //-------------------------------------------------------------------------
 real_t DistribGD::getCovInv(unsigned long i) const {return _covInvVect[i];}
 //-------------------------------------------------------------------------
-DoubleVector& DistribGD::getCovInvVect() { return _covInvVect; }
+DoubleVector& DistribGD::getCovInvVect()
+{
+  updateStamp();
+  return _covInvVect;
+}
 //-------------------------------------------------------------------------
 const DoubleVector& DistribGD::getCovInvVect() const { return _covInvVect; }
 //-------------------------------------------------------------------------
+real_t* DistribGD::getMeanArrayForAccumulation() // private
+{ return _meanVect.getArray(); }
+//-------------------------------------------------------------------------
+real_t* DistribGD::getCovArrayForAccumulation() // private
+{ return getCovVect().getArray(); }
+//-------------------------------------------------------------------------
 DoubleVector& DistribGD::getCovVect()
 {
   return const_cast<DoubleVector&>(
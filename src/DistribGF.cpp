@@ -74,6 +74,8 @@
 #include "DistribGF.h"
 #include "alizeString.h"
 #include "Feature.h"
+#include "FeatureBlock.h"
+#include "SimdKernels.h"
 #include "Exception.h"
 #include "Config.h"
 
@@ -81,14 +83,23 @@
 using namespace alize;
 using namespace std;
 
+// Scratch arrays up to this size are allocated on the stack
+static const unsigned long MAX_STACK_VECT_SIZE = 1024;
+
+// States of the Cholesky factor (_cholState)
+static const unsigned long CHOL_STALE = 0;    // built by the next block call
+static const unsigned long CHOL_BUILDING = 1; // being built by a thread
+static const unsigned long CHOL_VALID = 2;
+static const unsigned long CHOL_FAILED = 3;   // covInv not positive definite
+
 //-------------------------------------------------------------------------
 DistribGF::DistribGF(const unsigned long vectSize)
  :Distrib(vectSize), _covInvMatr(_vectSize),
- _cst(0.0), _tmpVect(_vectSize) {}
+ _cst(0.0), _cholState(CHOL_STALE) {}
 //-------------------------------------------------------------------------
 DistribGF::DistribGF(const Config& c)
  :Distrib(c.getParam_vectSize()>0?c.getParam_vectSize():1),
- _covInvMatr(_vectSize), _cst(0.0), _tmpVect(_vectSize) {}
+ _covInvMatr(_vectSize), _cst(0.0), _cholState(CHOL_STALE) {}
 //-------------------------------------------------------------------------
 void DistribGF::reset() // random init
 {
@@ -122,10 +133,15 @@ DistribGF& DistribGF::create(const K&, const Config& c)
 //-------------------------------------------------------------------------
 DistribGF::DistribGF(const DistribGF& d)
 :Distrib(d._vectSize), _covMatr(d._covMatr), _covInvMatr(d._covInvMatr),
- _cst(d._cst), _tmpVect(d._vectSize)
+ _cst(d._cst), _cholState(CHOL_STALE)
 {
   _meanVect = d._meanVect;
   _det = d._det;
+  const unsigned long s = atomicLoad(d._cholState);
+  if (s == CHOL_VALID)
+    _cholVect = d._cholVect;
+  if (s != CHOL_BUILDING)
+    _cholState = s;
 }
 //-------------------------------------------------------------------------
 const Distrib& DistribGF::operator=(const Distrib& d) // virtual
@@ -147,6 +163,11 @@ const DistribGF& DistribGF::operator=(const DistribGF& d)
   _covMatr = d._covMatr;
   _det = d._det;
   _cst = d._cst;
+  const unsigned long s = atomicLoad(d._cholState);
+  if (s == CHOL_VALID)
+    _cholVect = d._cholVect;
+  _cholState = (s == CHOL_BUILDING ? CHOL_STALE : s);
+  updateStamp();
   return *this;
 }
 //-------------------------------------------------------------------------
@@ -172,35 +193,59 @@ Distrib& DistribGF::clone() const // private
   return *p;
 }
 //-------------------------------------------------------------------------
-// TODO : A OPTIMISER !!
-//-------------------------------------------------------------------------
-lk_t DistribGF::computeLK(const Feature& frame) const
+// returns (f-m)' covInv (f-m)
+real_t DistribGF::computeDist(const Feature& frame) const // private
 {
   if (frame.getVectSize() != _vectSize)
     throw Exception("distrib vectSize ("
         + String::valueOf(_vectSize) + ") != feature vectSize ("
       + String::valueOf(frame.getVectSize()) + ")", __FILE__, __LINE__);
 
-  real_t tmp = 0.0;
-  real_t tmp2;
-  unsigned long i, j, ii;
-  real_t*      m = _meanVect.getArray();
-  real_t*      x = _tmpVect.getArray();
-  real_t*      c = _covInvMatr.getArray();
-  Feature::data_t* f = frame.getDataVector();
-
-  for (j=0; j<_vectSize; j++)
-    x[j] = f[j] - m[j];
-  for (i=0; i<_vectSize; i++)
+  if (_vectSize > MAX_STACK_VECT_SIZE)
   {
-    tmp2 = 0.0;
-    ii = i*_vectSize;
-    for (j=0; j<_vectSize; j++)
-      tmp2 += x[j] * c[j+ii];
-    tmp += tmp2 * x[i];
+    DoubleVector v(_vectSize, _vectSize);
+    return computeDist(frame.getDataVector(), v.getArray());
   }
-
-  tmp = _cst * exp(-0.5*tmp);
+  real_t v[MAX_STACK_VECT_SIZE];
+  return computeDist(frame.getDataVector(), v);
+}
+//-------------------------------------------------------------------------
+// d is a scratch array of _vectSize values
+real_t DistribGF::computeDist(const Feature::data_t* f, real_t* d) const
+{ // private
+  const real_t* m = _meanVect.getArray();
+  for (unsigned long j=0; j<_vectSize; j++)
+    d[j] = f[j] - m[j];
+  return SimdKernels::fullQuadForm(d, _covInvMatr.getArray(), _vectSize);
+}
+//-------------------------------------------------------------------------
+// distVect[t] = (f_t-m)' covInv (f_t-m), t < count
+void DistribGF::computeDistVect(const Feature::data_t* f, unsigned long count,
+                                real_t* distVect) const // private
+{
+  const unsigned long batchSize = SimdKernels::CHOLESKY_BATCH_SIZE;
+  const unsigned long n = _vectSize*batchSize;
+  DoubleVector heapVect;
+  real_t stackVect[MAX_STACK_VECT_SIZE];
+  real_t* r = stackVect;
+  if (n > MAX_STACK_VECT_SIZE)
+  {
+    heapVect.setSize(n);
+    r = heapVect.getArray();
+  }
+  unsigned long t = 0;
+  if (useCholesky())
+    for (; t+batchSize<=count; t+=batchSize)
+      SimdKernels::choleskyQuadFormVect(f+t*_vectSize,
+                   _meanVect.getArray(), _cholVect.getArray(), _vectSize,
+                   r, distVect+t);
+  for (; t<count; t++)
+    distVect[t] = computeDist(f+t*_vectSize, r);
+}
+//-------------------------------------------------------------------------
+lk_t DistribGF::computeLK(const Feature& frame) const
+{
+  real_t tmp = _cst * exp(-0.5*computeDist(frame));
   if (ISNAN(tmp))
     return EPS_LK;
   return tmp;
@@ -215,11 +260,62 @@ lk_t DistribGF::computeLK(const Feature& frame, unsigned long idx) const
   return tmp;
 }
 //-------------------------------------------------------------------------
+lk_t DistribGF::computeLogLK(const Feature& frame) const
+{ return log(_cst) - 0.5*computeDist(frame); }
+//-------------------------------------------------------------------------
+void DistribGF::computeAndAccumulateLK(const FeatureBlock& b,
+    unsigned long first, unsigned long count, weight_t w, lk_t* lkVect) const
+{
+  if (b.getVectSize() != _vectSize)
+    throw Exception("distrib vectSize ("
+        + String::valueOf(_vectSize) + ") != block vectSize ("
+      + String::valueOf(b.getVectSize()) + ")", __FILE__, __LINE__);
+  if (count == 0)
+    return;
+  assertIsInBounds(__FILE__, __LINE__, first+count-1, b.getFeatureCount());
+  const FeatureBlock::data_t* f = b.getFeatureVector(first);
+  real_t distVect[SimdKernels::CHOLESKY_BATCH_SIZE];
+
+  for (unsigned long t=0; t<count; t+=SimdKernels::CHOLESKY_BATCH_SIZE)
+  {
+    unsigned long n = count-t;
+    if (n > SimdKernels::CHOLESKY_BATCH_SIZE)
+      n = SimdKernels::CHOLESKY_BATCH_SIZE;
+    computeDistVect(f + t*_vectSize, n, distVect);
+    for (unsigned long j=0; j<n; j++)
+    {
+      real_t tmp = _cst * exp(-0.5*distVect[j]);
+      if (ISNAN(tmp))
+        tmp = EPS_LK;
+      lkVect[first+t+j] += w * tmp;
+    }
+  }
+}
+//-------------------------------------------------------------------------
+void DistribGF::computeLogLKVect(const FeatureBlock& b, unsigned long first,
+                                 unsigned long count, lk_t* logLkVect) const
+{
+  if (b.getVectSize() != _vectSize)
+    throw Exception("distrib vectSize ("
+        + String::valueOf(_vectSize) + ") != block vectSize ("
+      + String::valueOf(b.getVectSize()) + ")", __FILE__, __LINE__);
+  if (count == 0)
+    return;
+  assertIsInBounds(__FILE__, __LINE__, first+count-1, b.getFeatureCount());
+  computeDistVect(b.getFeatureVector(first), count, logLkVect);
+  const real_t logCst = log(_cst);
+  for (unsigned long t=0; t<count; t++)
+    logLkVect[t] = logCst - 0.5*logLkVect[t];
+}
+//-------------------------------------------------------------------------
 void DistribGF::computeAll()
 {
   // compute det and cov inv --------------------------------
 
-  _det = _covMatr.invert(_covInvMatr);
+  DoubleSquareMatrix l(_vectSize);
+  _det = _covMatr.invert(_covInvMatr, l);
+  setCholesky(l);
+  _cholState = CHOL_VALID;
 
   // compute cst -------------------------------
 
@@ -230,8 +326,63 @@ void DistribGF::computeAll()
 
   // remove cov matrix
   _covMatr.setSize(0, true);
+  updateStamp();
+}
+//-------------------------------------------------------------------------
+void DistribGF::computeCholesky()
+{
+  _cholState = CHOL_BUILDING;
+  buildCholesky();
+}
+//-------------------------------------------------------------------------
+// Returns true if the block methods can use the Cholesky factor. The
+// first thread finding it stale builds it; the other ones use covInv
+// meanwhile.
+bool DistribGF::useCholesky() const // private
+{
+  unsigned long s = atomicLoad(_cholState);
+  if (s == CHOL_STALE &&
+      atomicCompareAndSwap(_cholState, CHOL_STALE, CHOL_BUILDING))
+    s = buildCholesky();
+  return s == CHOL_VALID;
 }
 //-------------------------------------------------------------------------
+// The caller has set _cholState to CHOL_BUILDING. Returns the new state.
+unsigned long DistribGF::buildCholesky() const // private
+{
+  unsigned long s = CHOL_VALID;
+  try
+  {
+    DoubleSquareMatrix covInv(_covInvMatr), cov(_vectSize), l(_vectSize);
+    covInv.invert(cov);
+    cov.lowerCholesky(l);
+    setCholesky(l);
+  }
+  catch (Exception&) // not positive definite : covInv is used
+  {
+    s = CHOL_FAILED;
+  }
+  atomicStore(_cholState, s);
+  return s;
+}
+//-------------------------------------------------------------------------
+void DistribGF::setCholesky(const DoubleSquareMatrix& l) const // private
+{
+  // l(k, i) is L(i,k). Packed column by column (see
+  // SimdKernels::choleskyQuadFormVect())
+  _cholVect.setSize(_vectSize*(_vectSize+1)/2);
+  real_t* p = _cholVect.getArray();
+  for (unsigned long i=0; i<_vectSize; i++)
+  {
+    *p++ = 1.0/l(i, i);
+    for (unsigned long k=i+1; k<_vectSize; k++)
+      *p++ = l(i, k);
+  }
+}
+//-------------------------------------------------------------------------
+bool DistribGF::isCholeskyUpToDate() const
+{ return atomicLoad(_cholState) == CHOL_VALID; }
+//-------------------------------------------------------------------------
 void DistribGF::setCov(real_t v, unsigned long col, unsigned long row)
 {
   _covMatr.setSize(_vectSize);
@@ -242,7 +393,11 @@ void DistribGF::setCov(real_t v, unsigned long col, unsigned long row)
 //-------------------------------------------------------------------------
 void DistribGF::setCovInv(const K&, const real_t v, const unsigned long col,
                                                    const  unsigned long row)
-{ _covInvMatr(col, row) = v; }
+{
+  _covInvMatr(col, row) = v;
+  _cholState = CHOL_STALE;
+  updateStamp();
+}
 //-------------------------------------------------------------------------
 real_t DistribGF::getCov(unsigned long col, unsigned long row) const
 {
@@ -254,7 +409,12 @@ real_t DistribGF::getCovInv(const unsigned long col,
                             const unsigned long row) const
 { return _covInvMatr(col, row); }
 //-------------------------------------------------------------------------
-DoubleSquareMatrix& DistribGF::getCovInvMatrix() {return _covInvMatr;}
+DoubleSquareMatrix& DistribGF::getCovInvMatrix()
+{
+  _cholState = CHOL_STALE;
+  updateStamp();
+  return _covInvMatr;
+}
 //-------------------------------------------------------------------------
 const DoubleSquareMatrix& DistribGF::getCovInvMatrix() const {return _covInvMatr;}
 //-------------------------------------------------------------------------
@@ -106,12 +106,19 @@ void M::setSize(const unsigned long size, bool saveMemory)
   _array.setSize(size*size, saveMemory);
 }
 //-------------------------------------------------------------------------
-real_t M::invert(DoubleSquareMatrix& m)
+real_t M::invert(DoubleSquareMatrix& m) { return invert(&m, NULL); }
+//-------------------------------------------------------------------------
+real_t M::invert(DoubleSquareMatrix& m, DoubleSquareMatrix& l)
+{ return invert(&m, &l); }
+//-------------------------------------------------------------------------
+real_t M::lowerCholesky(DoubleSquareMatrix& l) { return invert(NULL, &l); }
+//-------------------------------------------------------------------------
+real_t M::invert(DoubleSquareMatrix* pM, DoubleSquareMatrix* pL) // private
 {
-  long size = m._size; // unsigned long -> long
+  long size = (long)_size; // unsigned long -> long
   if (size == 0)
     throw Exception("Cannot invert matrix : dimension = 0",__FILE__, __LINE__);
-  if (size != (long)_size)
+  if ((pM != NULL && pM->_size != _size) || (pL != NULL && pL->_size != _size))
 	  throw Exception("Cannot return the invert matrix : dimension not compatible",__FILE__, __LINE__);
 
 
@@ -121,7 +128,6 @@ real_t M::invert(DoubleSquareMatrix& m)
   DoubleVector diag(_size, _size);
   DoubleVector b(_size, _size);
   DoubleSquareMatrix tmp(*this);
-  real_t* pMatrix = m.getArray();
   real_t* pTmp = tmp.getArray();
   real_t* pDiag = diag.getArray();
   real_t* pB = b.getArray();
@@ -133,9 +139,28 @@ real_t M::invert(DoubleSquareMatrix& m)
   for (k=1; k<size; k++)
     det *= pDiag[k]*pDiag[k];
 
+  // The lower triangle of pTmp contains L (L(i,k) is pTmp[i + k*size]),
+  // the diagonal is in pDiag. Copy it row by row.
+  if (pL != NULL)
+  {
+    real_t* pFactor = pL->getArray();
+    for (j=0; j<size; j++)
+    {
+      unsigned long jsize = j*size;
+      for (k=0; k<j; k++)
+        pFactor[k + jsize] = pTmp[j + k*size];
+      pFactor[j + jsize] = pDiag[j];
+      for (k=j+1; k<size; k++)
+        pFactor[k + jsize] = 0.0;
+    }
+  }
+  if (pM == NULL)
+    return det;
+
   // Solve inverse of the matrix by forward and backward substitution.
   // The right hand side is a unit matrix, the solution is thus the
   // inverse of the matrix.
+  real_t* pMatrix = pM->getArray();
   for (j=0; j<size; j++)
   {
     // one column at a time
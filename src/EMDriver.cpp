@@ -0,0 +1,239 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+
+#if !defined(ALIZE_EMDriver_cpp)
+#define ALIZE_EMDriver_cpp
+
+#include <new>
+#include "EMDriver.h"
+#include "Config.h"
+#include "MixtureGD.h"
+#include "MixtureGDStat.h"
+#include "FeatureBlock.h"
+#include "FeatureServer.h"
+#include "Feature.h"
+#include "TaskPool.h"
+#include "alizeString.h"
+#include "Exception.h"
+
+using namespace alize;
+typedef EMDriver D;
+
+//-------------------------------------------------------------------------
+// accumulates the slices of a block of features
+class EMDriver::SliceTask : public TaskPool::Task
+{
+public :
+  SliceTask(EMDriver& d, const FeatureBlock& b)
+  :_d(d), _b(b), _n(b.getFeatureCount()),
+   _sliceSize((_n+d._sliceCount-1)/d._sliceCount) {}
+
+  virtual void run(unsigned long first, unsigned long last, unsigned long)
+  {
+    Feature f(_b.getVectSize());
+    for (unsigned long s=first; s<last; s++)
+    {
+      MixtureGDStat& stat = _d._statVect.getObject(s);
+      unsigned long end = (s+1)*_sliceSize;
+      if (end > _n)
+        end = _n;
+      for (unsigned long t=s*_sliceSize; t<end; t++)
+      {
+        _b.getFeature(f, t);
+        stat.computeAndAccumulateEM(f);
+      }
+    }
+  }
+private :
+  EMDriver&           _d;
+  const FeatureBlock& _b;
+  const unsigned long _n;
+  const unsigned long _sliceSize;
+};
+//-------------------------------------------------------------------------
+// one level of the summation tree : slice 2*i*step += slice (2*i+1)*step
+class EMDriver::ReduceTask : public TaskPool::Task
+{
+public :
+  ReduceTask(EMDriver& d, unsigned long step) :_d(d), _step(step) {}
+
+  virtual void run(unsigned long first, unsigned long last, unsigned long)
+  {
+    for (unsigned long i=first; i<last; i++)
+      _d._statVect.getObject(2*i*_step).addAccEM(
+          _d._statVect.getObject((2*i+1)*_step));
+  }
+private :
+  EMDriver&           _d;
+  const unsigned long _step;
+};
+//-------------------------------------------------------------------------
+D::EMDriver(const Config& c, const MixtureGD& m, unsigned long sliceCount)
+:Object(), _pMixture(&m), _statServer(c), _sliceCount(sliceCount),
+ _featureCount(0), _reduced(false), _pTaskPool(NULL), _ownTaskPool(true)
+{
+  if (sliceCount == 0)
+    throw Exception("sliceCount cannot be 0", __FILE__, __LINE__);
+  _pTaskPool = new (std::nothrow) TaskPool(c);
+  assertMemoryIsAllocated(_pTaskPool, __FILE__, __LINE__);
+  init(c);
+}
+//-------------------------------------------------------------------------
+D::EMDriver(const Config& c, const MixtureGD& m, TaskPool& p,
+            unsigned long sliceCount)
+:Object(), _pMixture(&m), _statServer(c), _sliceCount(sliceCount),
+ _featureCount(0), _reduced(false), _pTaskPool(&p), _ownTaskPool(false)
+{
+  if (sliceCount == 0)
+    throw Exception("sliceCount cannot be 0", __FILE__, __LINE__);
+  init(c);
+}
+//-------------------------------------------------------------------------
+void D::init(const Config& c) // private
+{
+  for (unsigned long s=0; s<_sliceCount; s++)
+    _statVect.addObject(MixtureGDStat::create(K::k, _statServer,
+                                              *_pMixture, c));
+  reset();
+}
+//-------------------------------------------------------------------------
+void D::reset()
+{
+  // sequential : resetEM() duplicates the mixture
+  for (unsigned long s=0; s<_sliceCount; s++)
+    _statVect.getObject(s).resetEM();
+  _featureCount = 0;
+  _reduced = false;
+}
+//-------------------------------------------------------------------------
+void D::accumulate(const FeatureBlock& b)
+{
+  if (_reduced)
+    throw Exception("reset() must be called after getEM()",
+                    __FILE__, __LINE__);
+  if (b.getVectSize() != _pMixture->getVectSize())
+    throw Exception("block vectSize ("
+        + String::valueOf(b.getVectSize()) + ") != mixture vectSize ("
+        + String::valueOf(_pMixture->getVectSize()) + ")",
+        __FILE__, __LINE__);
+  if (b.getFeatureCount() == 0)
+    return;
+  SliceTask t(*this, b);
+  _pTaskPool->parallelFor(0, _sliceCount, 1, t);
+  _featureCount += b.getFeatureCount();
+}
+//-------------------------------------------------------------------------
+void D::accumulate(FeatureServer& fs)
+{
+  Feature f;
+  FeatureBlock b(fs.getVectSize(), FEATURE_BLOCK_SIZE);
+  fs.reset();
+  while (fs.readFeature(f))
+  {
+    if (!f.isValid())
+      continue;
+    b.addFeature(f);
+    if (b.getFeatureCount() == FEATURE_BLOCK_SIZE)
+    {
+      accumulate(b);
+      b.clear();
+    }
+  }
+  accumulate(b);
+}
+//-------------------------------------------------------------------------
+const MixtureGD& D::getEM()
+{
+  if (!_reduced)
+  {
+    // fixed pairwise summation tree : the result does not depend on the
+    // number of threads
+    for (unsigned long step=1; step<_sliceCount; step*=2)
+    {
+      ReduceTask t(*this, step);
+      _pTaskPool->parallelFor(0, (_sliceCount-1+step)/(2*step), 1, t);
+    }
+    _reduced = true;
+  }
+  return static_cast<const MixtureGD&>(_statVect.getObject(0).getEM());
+}
+//-------------------------------------------------------------------------
+unsigned long D::getFeatureCount() const { return _featureCount; }
+//-------------------------------------------------------------------------
+unsigned long D::getSliceCount() const { return _sliceCount; }
+//-------------------------------------------------------------------------
+unsigned long D::getThreadCount() const
+{ return _pTaskPool->getThreadCount(); }
+//-------------------------------------------------------------------------
+String D::getClassName() const { return "EMDriver"; }
+//-------------------------------------------------------------------------
+String D::toString() const
+{
+  return Object::toString()
+    + "\n  mixture      = '" + _pMixture->getId() + "'"
+    + "\n  sliceCount   = " + String::valueOf(_sliceCount)
+    + "\n  threadCount  = " + String::valueOf(getThreadCount())
+    + "\n  featureCount = " + String::valueOf(_featureCount);
+}
+//-------------------------------------------------------------------------
+D::~EMDriver()
+{
+  _statVect.deleteAllObjects();
+  if (_ownTaskPool)
+    delete _pTaskPool;
+}
+//-------------------------------------------------------------------------
+
+#endif // !defined(ALIZE_EMDriver_cpp)
@@ -0,0 +1,157 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+#if !defined(ALIZE_FeatureBlock_cpp)
+#define ALIZE_FeatureBlock_cpp
+
+#include <memory.h>
+#include "FeatureBlock.h"
+#include "Feature.h"
+#include "alizeString.h"
+#include "Exception.h"
+
+using namespace alize;
+typedef FeatureBlock B;
+
+//-------------------------------------------------------------------------
+B::FeatureBlock(unsigned long vectSize, unsigned long capacity)
+:Object(), _vectSize(vectSize), _featureCount(0),
+ _dataVect(vectSize*capacity, 0) {}
+//-------------------------------------------------------------------------
+B::FeatureBlock(const FeatureBlock& b)
+:Object(), _vectSize(b._vectSize), _featureCount(b._featureCount),
+ _dataVect(b._dataVect) {}
+//-------------------------------------------------------------------------
+const FeatureBlock& B::operator=(const FeatureBlock& b)
+{
+  _vectSize = b._vectSize;
+  _featureCount = b._featureCount;
+  _dataVect = b._dataVect;
+  return *this;
+}
+//-------------------------------------------------------------------------
+unsigned long B::getVectSize() const { return _vectSize; }
+//-------------------------------------------------------------------------
+void B::setVectSize(unsigned long s)
+{
+  _vectSize = s;
+  clear();
+}
+//-------------------------------------------------------------------------
+unsigned long B::getFeatureCount() const { return _featureCount; }
+//-------------------------------------------------------------------------
+void B::setFeatureCount(unsigned long n)
+{
+  _dataVect.setSize(n*_vectSize);
+  _featureCount = n;
+}
+//-------------------------------------------------------------------------
+void B::clear()
+{
+  _dataVect.clear();
+  _featureCount = 0;
+}
+//-------------------------------------------------------------------------
+void B::addFeature(const Feature& f)
+{
+  // the vector is grown geometrically and its size is the reserved room,
+  // so filling a block frame by frame stays linear
+  const unsigned long needed = (_featureCount+1)*_vectSize;
+  if (needed > _dataVect.size())
+    _dataVect.setSize(2*needed);
+  _featureCount++;
+  setFeature(f, _featureCount-1);
+}
+//-------------------------------------------------------------------------
+void B::setFeature(const Feature& f, unsigned long idx)
+{
+  if (f.getVectSize() != _vectSize)
+    throw Exception("block vectSize ("
+        + String::valueOf(_vectSize) + ") != feature vectSize ("
+        + String::valueOf(f.getVectSize()) + ")", __FILE__, __LINE__);
+  memcpy(getFeatureVector(idx), f.getDataVector(),
+         _vectSize*sizeof(data_t));
+}
+//-------------------------------------------------------------------------
+void B::getFeature(Feature& f, unsigned long idx) const
+{
+  if (f.getVectSize() != _vectSize)
+    throw Exception("block vectSize ("
+        + String::valueOf(_vectSize) + ") != feature vectSize ("
+        + String::valueOf(f.getVectSize()) + ")", __FILE__, __LINE__);
+  memcpy(f.getDataVector(), getFeatureVector(idx),
+         _vectSize*sizeof(data_t));
+}
+//-------------------------------------------------------------------------
+B::data_t* B::getFeatureVector(unsigned long idx) const
+{
+  assertIsInBounds(__FILE__, __LINE__, idx, _featureCount);
+  return _dataVect.getArray() + idx*_vectSize;
+}
+//-------------------------------------------------------------------------
+B::data_t* B::getDataVector() const { return _dataVect.getArray(); }
+//-------------------------------------------------------------------------
+String B::getClassName() const { return "FeatureBlock"; }
+//-------------------------------------------------------------------------
+String B::toString() const
+{
+  return Object::toString()
+    + "\n  vectSize     = " + String::valueOf(_vectSize)
+    + "\n  featureCount = " + String::valueOf(_featureCount);
+}
+//-------------------------------------------------------------------------
+B::~FeatureBlock() {}
+//-------------------------------------------------------------------------
+
+#endif // !defined(ALIZE_FeatureBlock_cpp)
@@ -62,6 +62,7 @@
 #include "FeatureFileReaderSPro3.h"
 #include "FeatureFileReaderSPro4.h"
 #include "FeatureFileReaderHTK.h"
+#include "FeatureFileReaderCompressed.h"
 #include "Feature.h"
 #include "Exception.h"
 #include "LabelServer.h"
@@ -119,6 +120,9 @@ FeatureFileReaderAbstract& R::createStream(const FileName& f,
         return FeatureFileReaderHTK::create(f, c, p, be, b, bufferSize, h, historicSize);
     case FeatureFileReaderFormat_RAW:
         return FeatureFileReaderRaw::create(f, c, p, be, b, bufferSize, h, historicSize);
+    case FeatureFileReaderFormat_COMPRESSED:
+        return FeatureFileReaderCompressed::create(f, c, p, b, bufferSize,
+                                                   h, historicSize);
     }
   throw Exception("Param 'loadFeatureFileFormat' expected in the config",
                   __FILE__, __LINE__);
@@ -170,6 +174,34 @@ bool R::readFeature(Feature& f, unsigned long step)
   return ok;
 }
 //-------------------------------------------------------------------------
+unsigned long R::readFeatureView(FloatFeatureBlock& b, unsigned long n)
+{
+  if (_pFeatureReader == NULL)
+    return 0;
+  if (_seekWanted)
+  {
+    _seekWanted = false;
+    _pFeatureReader->seekFeature(_seekWantedIdx, _seekWantedSrcName);
+  }
+  unsigned long count = _pFeatureReader->readFeatureView(b, n);
+  _error = _pFeatureReader->getError();
+  return count;
+}
+//-------------------------------------------------------------------------
+unsigned long R::readFeatures(FeatureBlock& b, unsigned long n)
+{
+  if (_pFeatureReader == NULL)
+    return 0;
+  if (_seekWanted)
+  {
+    _seekWanted = false;
+    _pFeatureReader->seekFeature(_seekWantedIdx, _seekWantedSrcName);
+  }
+  unsigned long count = _pFeatureReader->readFeatures(b, n);
+  _error = _pFeatureReader->getError();
+  return count;
+}
+//-------------------------------------------------------------------------
 bool R::addFeature(const Feature& f)
 {
   if (_pFeatureReader == NULL)
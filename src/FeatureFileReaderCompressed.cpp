@@ -0,0 +1,256 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+
+#if !defined(ALIZE_FeatureFileReaderCompressed_cpp)
+#define ALIZE_FeatureFileReaderCompressed_cpp
+
+#include <new>
+#include "FeatureFileReaderCompressed.h"
+#include "FileReader.h"
+#include "Feature.h"
+#include "Exception.h"
+#include "LabelServer.h"
+#include "Label.h"
+#include "Config.h"
+#include "SimdKernels.h"
+
+using namespace alize;
+typedef FeatureFileReaderCompressed R;
+
+// see FeatureFileWriter
+static const unsigned long COMPRESSED_VERSION = 1;
+static const unsigned long COMPRESSED_BOM = 0x01020304;
+static const unsigned long COMPRESSED_SWAPPED_BOM = 0x04030201;
+static const unsigned long COMPRESSED_FLOAT16 = 1;
+static const unsigned long COMPRESSED_INT16 = 2;
+static const unsigned long COMPRESSED_HEADER_LENGTH = 64;
+
+//-------------------------------------------------------------------------
+R::FeatureFileReaderCompressed(const FileName& f, const Config& c,
+      LabelServer* l, BufferUsage b, unsigned long bufferSize,
+      HistoricUsage h, unsigned long historicSize)
+// the byte order is read in the file
+:FeatureFileReaderSingle(&FileReader::create(f, getPath(f, c),
+ getExt(f, c), false), NULL, c, l, b, bufferSize, h, historicSize),
+ _paramDefined(false), _compression(FeatureFileCompression_FLOAT16),
+ _pData(NULL), _dataSize(0) {}
+//-------------------------------------------------------------------------
+R& R::create(const FileName& f, const Config& c, LabelServer* l,
+             BufferUsage b, unsigned long bufferSize,
+             HistoricUsage h, unsigned long historicSize)
+{
+  R* p = new (std::nothrow)
+         FeatureFileReaderCompressed(f, c, l, b, bufferSize, h,
+                                     historicSize);
+  assertMemoryIsAllocated(p, __FILE__, __LINE__);
+  return *p;
+}
+//-------------------------------------------------------------------------
+void R::readParams() // private
+{
+  assert(_pReader != NULL);
+  _pReader->open(); // can throw FileNotFoundException
+
+  if (!readHeader())
+  {
+    _pReader->close();
+    throw InvalidDataException("Wrong header", __FILE__, __LINE__,
+                  _pReader->getFullFileName());
+  }
+}
+//-------------------------------------------------------------------------
+unsigned long R::getFeatureCount()
+{
+  if (!_paramDefined)
+    readParams();  // can throw FileNotFoundException
+  return _featureCount;
+}
+//-------------------------------------------------------------------------
+unsigned long R::getVectSize()
+{
+  if (!_paramDefined)
+    readParams(); // can throw FileNotFoundException
+  return _vectSize;
+}
+//-------------------------------------------------------------------------
+const FeatureFlags& R::getFeatureFlags()
+{
+  if (!_paramDefined)
+    readParams(); // can throw FileNotFoundException
+  return _flags;
+}
+//-------------------------------------------------------------------------
+real_t R::getSampleRate()
+{
+  if (!_paramDefined)
+    readParams(); // can throw FileNotFoundException
+  return _sampleRate;
+}
+//-------------------------------------------------------------------------
+FeatureFileCompression R::getCompression()
+{
+  if (!_paramDefined)
+    readParams(); // can throw FileNotFoundException
+  return _compression;
+}
+//-------------------------------------------------------------------------
+unsigned long R::getHeaderLength() // private
+{
+  if (!_paramDefined)
+    readParams(); // can throw FileNotFoundException
+  return _headerLength;
+}
+//-------------------------------------------------------------------------
+String R::getClassName() const { return "FeatureFileReaderCompressed";}
+//-------------------------------------------------------------------------
+bool R::readHeader() // private
+{
+  assert(_pReader != NULL);
+  if (_pReader->getFileLength() < COMPRESSED_HEADER_LENGTH ||
+      _pReader->readString(8) != "ALIZECFF")
+    return false;
+  unsigned int version = (unsigned int)_pReader->readUInt4();
+  const unsigned long bom = _pReader->readUInt4();
+  if (bom == COMPRESSED_SWAPPED_BOM)
+  {
+    _pReader->swap() = true; // for the next values
+    _pReader->swap4Bytes(&version);
+  }
+  else if (bom != COMPRESSED_BOM)
+    return false;
+  if (version != COMPRESSED_VERSION)
+    return false;
+  const unsigned long encoding = _pReader->readUInt4();
+  if (encoding == COMPRESSED_FLOAT16)
+    _compression = FeatureFileCompression_FLOAT16;
+  else if (encoding == COMPRESSED_INT16)
+    _compression = FeatureFileCompression_INT16;
+  else
+    return false;
+  _vectSize = _pReader->readUInt4();
+  _featureCount = _pReader->readUInt4();
+  const String& flags = _pReader->readString(8);
+  if (flags.length() < 6)
+    return false;
+  for (unsigned long i=0; i<6; i++)
+    if (flags[i] != "0" && flags[i] != "1")
+      return false;
+  _flags.set(flags);
+  _sampleRate = (real_t)_pReader->readFloat();
+  if (_vectSize == 0)
+    return false;
+  _headerLength = COMPRESSED_HEADER_LENGTH;
+  _pReader->seek(_headerLength); // reserved bytes
+  if (_compression == FeatureFileCompression_INT16)
+  {
+    _scaleVect.setSize(_vectSize);
+    _offsetVect.setSize(_vectSize);
+    for (unsigned long i=0; i<_vectSize; i++)
+      _scaleVect[i] = _pReader->readFloat();
+    for (unsigned long i=0; i<_vectSize; i++)
+      _offsetVect[i] = _pReader->readFloat();
+    _headerLength += 2*_vectSize*sizeof(float);
+  }
+  if (_pReader->getFileLength() < _headerLength +
+                      _featureCount*_vectSize*sizeof(unsigned short))
+    return false;
+  _paramDefined = true;
+  return true;
+}
+//-------------------------------------------------------------------------
+void R::seekFeatureData(unsigned long idx) // private
+{
+  _pReader->seek(getHeaderLength() +
+                 idx*getVectSize()*sizeof(unsigned short));
+}
+//-------------------------------------------------------------------------
+unsigned long R::readFeatureData(FloatVector& v) // private
+{
+  // also called by the read-ahead thread
+  unsigned long n = v.size();
+  if (n > _dataSize)
+  {
+    delete [] _pData;
+    _pData = new (std::nothrow) unsigned short[n];
+    assertMemoryIsAllocated(_pData, __FILE__, __LINE__);
+    _dataSize = n;
+  }
+  n = _pReader->readSomeBytes(_pData, n*sizeof(unsigned short))
+      /sizeof(unsigned short);
+  if (_pReader->swap())
+    for (unsigned long i=0; i<n; i++)
+      _pData[i] = (unsigned short)((_pData[i] >> 8) | (_pData[i] << 8));
+  if (_compression == FeatureFileCompression_FLOAT16)
+  {
+    SimdKernels::halfToFloat(_pData, v.getArray(), n);
+    return n;
+  }
+  const unsigned long count = n/_vectSize;
+  SimdKernels::dequantize(reinterpret_cast<const short*>(_pData),
+          _scaleVect.getArray(), _offsetVect.getArray(), _vectSize, count,
+          v.getArray());
+  return count*_vectSize;
+}
+//-------------------------------------------------------------------------
+bool R::featureDataIsFloat() { return false; } // private
+//-------------------------------------------------------------------------
+R::~FeatureFileReaderCompressed()
+{
+  stopReadAhead(); // the read-ahead thread uses _pData
+  delete [] _pData;
+}
+//-------------------------------------------------------------------------
+
+#endif // !defined(ALIZE_FeatureFileReaderCompressed_cpp)
@@ -191,7 +191,10 @@ bool R::readHeader()
 //-------------------------------------------------------------------------
 unsigned long R::getHeaderLength() { return 12; }
 //-------------------------------------------------------------------------
-R::~FeatureFileReaderHTK() {}
+R::~FeatureFileReaderHTK()
+{
+  stopReadAhead();
+}
 //-------------------------------------------------------------------------
 
 #endif // !defined(ALIZE_FeatureFileReaderHTK_cpp)
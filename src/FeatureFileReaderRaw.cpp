@@ -121,7 +121,10 @@ real_t R::getSampleRate() { return getConfig().getParam_sampleRate(); }
 //-------------------------------------------------------------------------
 String R::getClassName() const { return "FeatureFileReaderRaw"; }
 //-------------------------------------------------------------------------
-R::~FeatureFileReaderRaw() {}
+R::~FeatureFileReaderRaw()
+{
+  stopReadAhead();
+}
 //-------------------------------------------------------------------------
 
 #endif // !defined(ALIZE_FeatureFileReaderRaw_cpp)
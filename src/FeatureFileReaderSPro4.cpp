@@ -245,7 +245,10 @@ bool R::readHeader()
   return true;
 }
 //-------------------------------------------------------------------------
-R::~FeatureFileReaderSPro4() {}
+R::~FeatureFileReaderSPro4()
+{
+  stopReadAhead();
+}
 //-------------------------------------------------------------------------
 /*
 Format en-tete fichier SPRO 4.0
@@ -56,6 +56,9 @@
 #define ALIZE_FeatureFileReaderSingle_cpp
 
 #include <new>
+#if defined(THREAD)
+#include <pthread.h>
+#endif
 #include "FeatureFileReaderSingle.h"
 #include "FileReader.h"
 #include "Exception.h"
@@ -65,12 +68,36 @@
 #include "Config.h"
 #include "RealVector.h"
 #include "FileReader.h"
+#include "FeatureBlock.h"
+#include "FloatFeatureBlock.h"
 
 #include <iostream>
 
 using namespace alize;
 typedef FeatureFileReaderSingle R;
 
+//-------------------------------------------------------------------------
+// block loaded by a background thread
+struct FeatureFileReaderSingle::ReadAhead
+{
+#if defined(THREAD)
+  pthread_t     thread;
+#endif
+  FeatureFileReaderSingle* pOwner;
+  FloatVector*  pBuffer;
+  unsigned long vectSize;
+  unsigned long floatCount; /*!< number of floats read */
+  bool          failed;
+
+  static void* run(void* p)
+  {
+    ReadAhead& a = *static_cast<ReadAhead*>(p);
+    try { a.floatCount = a.pOwner->readFeatureData(*a.pBuffer); }
+    catch (...) { a.failed = true; }
+    return NULL;
+  }
+};
+
 //-------------------------------------------------------------------------
 R::FeatureFileReaderSingle(FileReader* r, FeatureInputStream* st, 
                            const Config& c, LabelServer* p,
@@ -79,7 +106,11 @@ R::FeatureFileReaderSingle(FileReader* r, FeatureInputStream* st,
 :FeatureFileReaderAbstract(NULL, c, p, b, bufferSize, h, historicSize),
  _pReader(r), _pFeatureInputStream(st), _pFeature(NULL), _featureIndex(0),
  _lastFeatureIndex(0),
- _featureIndexOfBuffer(0), _nbStored(0), _pBuffer(&FloatVector::create())
+ _featureIndexOfBuffer(0), _nbStored(0), _pBuffer(&FloatVector::create()),
+ _pNextBuffer(NULL), _featureIndexOfNextBuffer(0), _nbStoredInNextBuffer(0),
+ _pReadAhead(NULL), _seekNeeded(false), _mappingDisabled(false),
+ _nextMappedFeatureIndex(0), _sourceLabelDefined(false),
+ _sourceLabelCode(0)
 {}
 //-------------------------------------------------------------------------
 String R::getPath(const FileName& f, const Config& c) const
@@ -112,6 +143,8 @@ bool R::getBigEndian(const Config& c, BigEndian b) const // protected
 //-------------------------------------------------------------------------
 void R::close()
 {
+  if (waitReadAhead())
+    _seekNeeded = true; // the next block is lost
   if (_pReader != NULL)
     _pReader->close();
   if (_pFeatureInputStream != NULL)
@@ -137,9 +170,30 @@ bool R::readFeature(Feature& f, unsigned long step)
   unsigned long featureCount = getFeatureCount();
   if (_featureIndex >= featureCount)
     return false;
+  const float* pMapped = getMappedFeatures();
   // si on demande une feature hors du buffer
-  if (_featureIndex < _featureIndexOfBuffer ||
-      _featureIndex >= _featureIndexOfBuffer + _nbStored)
+  if (pMapped == NULL && (_featureIndex < _featureIndexOfBuffer ||
+      _featureIndex >= _featureIndexOfBuffer + _nbStored))
+  {
+    // the feature may be in the block loaded in background
+    if (waitReadAhead())
+    {
+      if (_featureIndex >= _featureIndexOfNextBuffer &&
+          _featureIndex < _featureIndexOfNextBuffer + _nbStoredInNextBuffer)
+      {
+        FloatVector* p = _pBuffer;
+        _pBuffer = _pNextBuffer;
+        _pNextBuffer = p;
+        _featureIndexOfBuffer = _featureIndexOfNextBuffer;
+        _nbStored = _nbStoredInNextBuffer;
+        startReadAhead();
+      }
+      else
+        _seekNeeded = true; // after seekFeature() : the block is useless
+    }
+  }
+  if (pMapped == NULL && (_featureIndex < _featureIndexOfBuffer ||
+      _featureIndex >= _featureIndexOfBuffer + _nbStored))
   {
     if (!_bufferSizeDefined)
     {
@@ -161,6 +215,7 @@ bool R::readFeature(Feature& f, unsigned long step)
       }
       if (m < getVectSize()) // minimum size
         m = getVectSize();
+      m -= m % getVectSize(); // whole features only
       _pBuffer->setSize(m);
       _bufferSizeDefined = true;
     }
@@ -176,9 +231,10 @@ bool R::readFeature(Feature& f, unsigned long step)
     }
     // si le bloc de donnees a charger ne suit pas le bloc deja en memoire
     // on se repositionne dans le fichier
-    if (start != _featureIndexOfBuffer + _nbStored /*+ 1*/) {
+    if (_seekNeeded || start != _featureIndexOfBuffer + _nbStored /*+ 1*/) {
+      _seekNeeded = false;
       if (_pReader != NULL) {
-        _pReader->seek(getHeaderLength() + start*getVectSize()*sizeof(float));
+        seekFeatureData(start);
       }
       else {
         _pFeatureInputStream->seekFeature(start);
@@ -186,7 +242,7 @@ bool R::readFeature(Feature& f, unsigned long step)
     }
     // chargement des donnees dans le buffer
     if (_pReader != NULL)
-      _nbStored = _pReader->readSomeFloats(*_pBuffer)/getVectSize();
+      _nbStored = readFeatureData(*_pBuffer)/getVectSize();
     else
     {
       // Pas performant. A amliorer
@@ -207,30 +263,98 @@ bool R::readFeature(Feature& f, unsigned long step)
     if (_nbStored == featureCount)
       close();
     else
+    {
       // donnes pas toutes en mmoire -> interdit le writeFeature()
       _featuresAreWritable = false;
+      startReadAhead();
+    }
   }
   f.setVectSize(K::k, getVectSize());
-  f.setData(*_pBuffer, (_featureIndex-_featureIndexOfBuffer)*getVectSize());
+  if (pMapped != NULL)
+  {
+    if (_featureIndex != _nextMappedFeatureIndex)
+      _pReader->adviseMapping(false); // random access
+    const unsigned long vectSize = getVectSize();
+    const float* src = pMapped + _featureIndex*vectSize;
+    Feature::data_t* dest = f.getDataVector();
+    for (unsigned long i=0; i<vectSize; i++)
+      dest[i] = (Feature::data_t)src[i];
+    _nextMappedFeatureIndex = _featureIndex + step;
+  }
+  else
+    f.setData(*_pBuffer, (_featureIndex-_featureIndexOfBuffer)*getVectSize());
   f.setValidity(true);
 
   _featureIndex += step;
   if (_featureIndex > _lastFeatureIndex)
     _lastFeatureIndex = _featureIndex;
   if (_pLabelServer != NULL)
-  {
-    Label l;
-    if (_pReader != NULL)
-      l.setSourceName(_pReader->getFileName());
-    else
-      l.setSourceName(_pFeatureInputStream->getNameOfASource(0)); // TODO : not always 0 ?
-    f.setLabelCode(_pLabelServer->addLabel(l));
-  }
+    f.setLabelCode(getSourceLabelCode());
   _error = NO_ERROR;
   return true;
 }
 //-------------------------------------------------------------------------
+unsigned long R::readFeatureView(FloatFeatureBlock& b, unsigned long n)
+{
+  b.setVectSize(getVectSize());
+  const float* p = readFrames(n);
+  b.setView(p, n);
+  return n;
+}
+//-------------------------------------------------------------------------
+unsigned long R::readFeatures(FeatureBlock& b, unsigned long n)
+{
+  const unsigned long first = prepareBlock(b);
+  const unsigned long vectSize = getVectSize();
+  unsigned long count = 0;
+  while (count < n)
+  {
+    unsigned long k = n - count;
+    const float* src = readFrames(k);
+    if (k == 0)
+      break;
+    b.setFeatureCount(first+count+k);
+    FeatureBlock::data_t* dest = b.getFeatureVector(first+count);
+    for (unsigned long i=0; i<k*vectSize; i++)
+      dest[i] = (FeatureBlock::data_t)src[i];
+    count += k;
+  }
+  return count;
+}
+//-------------------------------------------------------------------------
+const float* R::readFrames(unsigned long& n) // private
+{
+  // positions the stream and loads the buffer if needed (step 0)
+  if (n == 0 || !readFeature(_f, 0) || _error != NO_ERROR)
+  {
+    n = 0;
+    return NULL;
+  }
+  const unsigned long vectSize = getVectSize();
+  const float* p;
+  unsigned long available;
+  const float* pMapped = getMappedFeatures();
+  if (pMapped != NULL)
+  {
+    p = pMapped + _featureIndex*vectSize;
+    available = getFeatureCount() - _featureIndex;
+  }
+  else
+  {
+    p = _pBuffer->getArray() + (_featureIndex-_featureIndexOfBuffer)*vectSize;
+    available = _featureIndexOfBuffer + _nbStored - _featureIndex;
+  }
+  if (n > available)
+    n = available;
+  _featureIndex += n;
+  _nextMappedFeatureIndex = _featureIndex;
+  if (_featureIndex > _lastFeatureIndex)
+    _lastFeatureIndex = _featureIndex;
+  return p;
+}
+//-------------------------------------------------------------------------
 bool R::addFeature(const Feature& f) {
+  disableMapping();
 	/* if not yet read --> not charged in memory */
 	if (_nbStored == 0) {
 		Feature tmp;
@@ -259,6 +383,7 @@ bool R::writeFeature(const Feature& f, unsigned long step)
   if (!_featuresAreWritable)
     throw Exception("Feature writing forbidden", __FILE__, __LINE__);
   assert(_pReader != NULL || _pFeatureInputStream != NULL);
+  disableMapping(); // the features must be in the buffer
   if (_seekWanted)
   {
     _seekWanted = false;
@@ -295,6 +420,7 @@ bool R::writeFeature(const Feature& f, unsigned long step)
       }
       if (m < getVectSize()) // minimum size
         m = getVectSize();
+      m -= m % getVectSize(); // whole features only
       _pBuffer->setSize(m);
       _bufferSizeDefined = true;
     }
@@ -308,11 +434,14 @@ bool R::writeFeature(const Feature& f, unsigned long step)
       else
         start = 0;
     }
+    if (waitReadAhead())
+      _seekNeeded = true;
     // si le bloc de donnees a charger ne suit pas le bloc deja en memoire
     // on se repositionne dans le fichier
-    if (start != _featureIndexOfBuffer + _nbStored + 1) {
+    if (_seekNeeded || start != _featureIndexOfBuffer + _nbStored + 1) {
+      _seekNeeded = false;
       if (_pReader != NULL) {
-        _pReader->seek(getHeaderLength() + start*getVectSize()*sizeof(float));
+        seekFeatureData(start);
       }
       else {
         _pFeatureInputStream->seekFeature(start);
@@ -320,7 +449,7 @@ bool R::writeFeature(const Feature& f, unsigned long step)
     }
     // chargement des donnees dans le buffer
     if (_pReader != NULL)
-      _nbStored = _pReader->readSomeFloats(*_pBuffer)/getVectSize();
+      _nbStored = readFeatureData(*_pBuffer)/getVectSize();
     else
     {
       // Pas performant. A amliorer
@@ -358,6 +487,120 @@ bool R::writeFeature(const Feature& f, unsigned long step)
   return true;
 }
 //-------------------------------------------------------------------------
+void R::startReadAhead() // private
+{
+#if defined(THREAD)
+  assert(_pReadAhead == NULL);
+  if (_pReader == NULL || !_bufferIsInternal ||
+      !getConfig().existsParam_loadFeatureFileReadAhead ||
+      !getConfig().getParam_loadFeatureFileReadAhead() ||
+      _featureIndexOfBuffer + _nbStored >= getFeatureCount())
+    return;
+  // the file is positioned at the end of the buffer
+  if (_pNextBuffer == NULL)
+    _pNextBuffer = &FloatVector::create();
+  _pNextBuffer->setSize(_pBuffer->size());
+  _featureIndexOfNextBuffer = _featureIndexOfBuffer + _nbStored;
+  _nbStoredInNextBuffer = 0;
+  ReadAhead* p = new (std::nothrow) ReadAhead;
+  assertMemoryIsAllocated(p, __FILE__, __LINE__);
+  p->pOwner = this;
+  p->pBuffer = _pNextBuffer;
+  p->vectSize = getVectSize();
+  p->floatCount = 0;
+  p->failed = false;
+  if (pthread_create(&p->thread, NULL, ReadAhead::run, p) != 0)
+  {
+    delete p; // the next block will be read synchronously
+    return;
+  }
+  _pReadAhead = p;
+#endif
+}
+//-------------------------------------------------------------------------
+bool R::waitReadAhead() // private
+{
+#if defined(THREAD)
+  if (_pReadAhead == NULL)
+    return false;
+  pthread_join(_pReadAhead->thread, NULL);
+  const bool ok = !_pReadAhead->failed;
+  // no virtual call : also used by the destructor
+  _nbStoredInNextBuffer = ok ? _pReadAhead->floatCount/_pReadAhead->vectSize
+                             : 0;
+  delete _pReadAhead;
+  _pReadAhead = NULL;
+  if (!ok)
+    _seekNeeded = true; // the block will be read again synchronously
+  return ok;
+#else
+  return false;
+#endif
+}
+//-------------------------------------------------------------------------
+void R::stopReadAhead() { waitReadAhead(); }
+//-------------------------------------------------------------------------
+const float* R::getMappedFeatures() // private
+{
+  if (_pReader == NULL || _mappingDisabled)
+    return NULL;
+  if (!featureDataIsFloat())
+  {
+    _mappingDisabled = true;
+    return NULL;
+  }
+  const char* p = _pReader->getMapping();
+  if (p == NULL)
+  {
+    const unsigned long headerLength = getHeaderLength();
+    if (!getConfig().existsParam_loadFeatureFileMemoryMap ||
+        !getConfig().getParam_loadFeatureFileMemoryMap() ||
+        _pReader->swap() || headerLength % sizeof(float) != 0 ||
+        (p = _pReader->map()) == NULL ||
+        _pReader->getFileLength() < headerLength +
+                        getFeatureCount()*getVectSize()*sizeof(float))
+    {
+      disableMapping();
+      return NULL;
+    }
+    _nextMappedFeatureIndex = 0;
+  }
+  return reinterpret_cast<const float*>(p + getHeaderLength());
+}
+//-------------------------------------------------------------------------
+unsigned long R::getSourceLabelCode() // private
+{
+  if (!_sourceLabelDefined)
+  {
+    if (_pReader != NULL)
+      _sourceLabel.setSourceName(_pReader->getFileName());
+    else
+      _sourceLabel.setSourceName(_pFeatureInputStream->getNameOfASource(0)); // TODO : not always 0 ?
+    _sourceLabelDefined = true;
+  }
+  // the label server may have been cleared or modified since the last call
+  if (_sourceLabelCode >= _pLabelServer->size() ||
+      _pLabelServer->getLabel(_sourceLabelCode) != _sourceLabel)
+    _sourceLabelCode = _pLabelServer->addLabel(_sourceLabel);
+  return _sourceLabelCode;
+}
+//-------------------------------------------------------------------------
+void R::disableMapping() // private
+{
+  if (_pReader != NULL)
+    _pReader->unmap();
+  _mappingDisabled = true;
+}
+//-------------------------------------------------------------------------
+const float* R::getMappedFeature(unsigned long idx)
+{
+  const float* p = getMappedFeatures();
+  if (p == NULL)
+    return NULL;
+  assertIsInBounds(__FILE__, __LINE__, idx, getFeatureCount());
+  return p + idx*getVectSize();
+}
+//-------------------------------------------------------------------------
 bool R::featureWantedIsInHistoric() const
 {
   if (_seekWantedIdx > _lastFeatureIndex)
@@ -369,6 +612,8 @@ bool R::featureWantedIsInHistoric() const
 //-------------------------------------------------------------------------
 void R::setExternalBufferToUse(FloatVector& v)
 {
+  if (waitReadAhead())
+    _seekNeeded = true;
   if (_bufferIsInternal && _pBuffer != NULL )
     delete _pBuffer;
   _pBuffer = &v;
@@ -381,6 +626,16 @@ void R::setExternalBufferToUse(FloatVector& v)
 // Comportement par defaut. Methode surchargee dans les sous-classes
 unsigned long R::getHeaderLength() { return 0; }
 //-------------------------------------------------------------------------
+void R::seekFeatureData(unsigned long idx) // private virtual
+{
+  _pReader->seek(getHeaderLength() + idx*getVectSize()*sizeof(float));
+}
+//-------------------------------------------------------------------------
+unsigned long R::readFeatureData(FloatVector& v) // private virtual
+{ return _pReader->readSomeFloats(v); }
+//-------------------------------------------------------------------------
+bool R::featureDataIsFloat() { return true; } // private virtual
+//-------------------------------------------------------------------------
 unsigned long R::getSourceCount() {return 1;}
 //-------------------------------------------------------------------------
 unsigned long R::getFeatureCountOfASource(unsigned long srcIdx)
@@ -462,6 +717,9 @@ String R::toString() const
 //-------------------------------------------------------------------------
 R::~FeatureFileReaderSingle()
 {
+  waitReadAhead();
+  if (_pNextBuffer != NULL)
+    delete _pNextBuffer;
   if (_pReader != NULL)
     delete _pReader;
   // do not delete _pFeatureInputStream
@@ -56,19 +56,45 @@
 #define ALIZE_FeatureFileWriterFormat_cpp
 
 #include <new>
+#include <cmath>
+#include <memory.h>
 #include "FeatureFileWriter.h"
 #include "Feature.h"
+#include "FeatureBlock.h"
+#include "FloatFeatureBlock.h"
 #include "Exception.h"
 #include "Config.h"
+#include "SimdKernels.h"
 
 using namespace alize;
 typedef FeatureFileWriter W;
 
+// number of values converted at once by writeFeatures(FeatureBlock&)
+// and by the float16 encoding
+static const unsigned long CONVERSION_BUFFER_SIZE = 16384;
+
+// see FeatureFileReaderCompressed
+static const unsigned long COMPRESSED_VERSION = 1;
+static const unsigned long COMPRESSED_BOM = 0x01020304;
+static const unsigned long COMPRESSED_FLOAT16 = 1;
+static const unsigned long COMPRESSED_INT16 = 2;
+static const unsigned long COMPRESSED_HEADER_LENGTH = 64;
+static const unsigned long COMPRESSED_COUNT_POSITION = 24;
+
 //-------------------------------------------------------------------------
 W::FeatureFileWriter(const FileName& f, const Config& c)
 :FileWriter(getFullFileName(c, f)),
  _format(c.getParam_saveFeatureFileFormat()), _vectSizeDefined(false),
- _headerWritten(false), _config(c) {}
+ _headerWritten(false), _config(c),
+ _compression(c.existsParam_saveFeatureFileCompression ?
+              c.getParam_saveFeatureFileCompression() :
+              FeatureFileCompression_FLOAT16),
+ _dataCapacity(0), _pCodeBuffer(NULL), _codeBufferSize(0)
+{
+  if (c.existsParam_saveFeatureFileBackgroundFlush &&
+      c.getParam_saveFeatureFileBackgroundFlush())
+    setBackgroundFlush(true);
+}
 //-------------------------------------------------------------------------
 W& W::create(const FileName& f, const Config& c)
 {
@@ -86,110 +112,266 @@ String W::getFullFileName(const Config& c, const FileName& f) const
 }
 //-------------------------------------------------------------------------
 void W::writeFeature(const Feature& f)
+{
+  const unsigned long vectSize = f.getVectSize();
+  _frameVect.setSize(vectSize);
+  for (unsigned long i=0; i<vectSize; i++)
+    _frameVect[i] = (float)f[i];
+  writeFrames(_frameVect.getArray(), vectSize, 1);
+}
+//-------------------------------------------------------------------------
+void W::writeFeatures(const FeatureBlock& b)
+{
+  const unsigned long vectSize = b.getVectSize();
+  const unsigned long featureCount = b.getFeatureCount();
+  if (featureCount == 0 || vectSize == 0)
+    return;
+  // conversion to single precision by groups of features
+  unsigned long n = CONVERSION_BUFFER_SIZE/vectSize;
+  if (n == 0)
+    n = 1;
+  for (unsigned long t=0; t<featureCount; t+=n)
+  {
+    if (n > featureCount-t)
+      n = featureCount-t;
+    const FeatureBlock::data_t* src = b.getFeatureVector(t);
+    _frameVect.setSize(n*vectSize);
+    float* dest = _frameVect.getArray();
+    for (unsigned long i=0; i<n*vectSize; i++)
+      dest[i] = (float)src[i];
+    writeFrames(dest, vectSize, n);
+  }
+}
+//-------------------------------------------------------------------------
+void W::writeFeatures(const FloatFeatureBlock& b)
+{
+  if (b.getFeatureCount() != 0)
+    writeFrames(b.getDataVector(), b.getVectSize(), b.getFeatureCount());
+}
+//-------------------------------------------------------------------------
+void W::writeFrames(const float* p, unsigned long vectSize,
+                    unsigned long count) // private
 {
   if (!_vectSizeDefined)
   {
-    _vectSize = f.getVectSize();
+    _vectSize = vectSize;
     _vectSizeDefined = true;
   }
   else
-    if (f.getVectSize() != _vectSize)
+    if (vectSize != _vectSize)
       throw Exception("Incompatible vectSize", __FILE__, __LINE__);
 
   if (isClosed())
     open();
+  if (!_headerWritten)
+    writeHeader();
 
-  if (_format == FeatureFileWriterFormat_RAW) // **************************************************
+  const unsigned long n = count*_vectSize;
+  if (_format == FeatureFileWriterFormat_COMPRESSED)
   {
-    for (unsigned long i=0; i<_vectSize; i++)
+    if (_compression == FeatureFileCompression_FLOAT16)
+      for (unsigned long i=0; i<n; i+=_codeBufferSize)
+      {
+        const unsigned long m = (n-i < _codeBufferSize) ? n-i
+                                                         : _codeBufferSize;
+        SimdKernels::floatToHalf(p+i, _pCodeBuffer, m);
+        writeBytes(_pCodeBuffer, m*sizeof(unsigned short));
+      }
+    else // quantized by close()
     {
-      writeFloat((float)f[i]);
+      const unsigned long size = _dataVect.size();
+      if (size+n > _dataCapacity)
+      {
+        _dataCapacity = 2*(size+n);
+        _dataVect.setSize(_dataCapacity); // capacity only grows
+      }
+      _dataVect.setSize(size+n);
+      memcpy(_dataVect.getArray()+size, p, n*sizeof(float));
     }
   }
-  else if (_format == FeatureFileWriterFormat_SPRO3) // *******************************************
+  else // RAW, SPRO3, SPRO4
+    writeBytes(p, n*sizeof(float));
+  _featureCount += count;
+}
+//-------------------------------------------------------------------------
+void W::writeHeader() // private
+{
+  _featureCount = 0;
+  if (_format == FeatureFileWriterFormat_SPRO3) // *************************
+  {
+    const FeatureFlags flags = _config.getParam_featureFlags();
+    unsigned long dim = 0;
+    const String& s = flags.getString();
+    if (s == "100000")
+      dim = _vectSize;
+    else if (s == "110000")
+      dim = _vectSize-1;
+    else if (s == "101000")
+      dim = _vectSize/2;
+    else if (s == "111000" || s == "101100")
+      dim = (_vectSize-1)/2;
+    else if (s == "111100")
+      dim = (_vectSize-2)/2;
+    else if (s == "100010")
+      dim = _vectSize/2;
+    else if (s == "110010")
+      dim = (_vectSize-1)/2;
+    else if (s == "101010")
+      dim = _vectSize/3;
+    else if (s == "111010" || s == "101110")
+      dim = (_vectSize-1)/3;
+    else if (s == "111110")
+      dim = (_vectSize-2)/3;
+    else if (s == "100011")
+      dim = (_vectSize-1)/2;
+    else if (s == "110011")
+      dim = (_vectSize-2)/2;
+    else if (s == "101011")
+      dim = (_vectSize-1)/3;
+    else if (s == "111011" || s == "101111")
+      dim = (_vectSize-2)/3;
+    else if (s == "111111")
+      dim = (_vectSize-3)/3;
+    else
+      throw Exception("Wrong featureFlag : " + s,
+               __FILE__, __LINE__);
+    writeUInt4(_config.getParam_saveFeatureFileSPro3DataKind());
+    writeUInt4(dim);
+    writeUInt4(0); // updated by close()
+    writeUInt4(flags.toSPro3());
+  }
+  else if (_format == FeatureFileWriterFormat_SPRO4) // ******************
+  {
+    writeString("<header>\n");
+    writeString("</header>\n");
+    writeShort((short)_vectSize);
+    writeUInt4(_config.getParam_featureFlags().toSPro4());
+    writeFloat((float)_config.getParam_sampleRate());
+  }
+  else if (_format == FeatureFileWriterFormat_COMPRESSED) // *************
   {
-    if (!_headerWritten)
+    // at least one feature, for the int16 quantization
+    _codeBufferSize = (CONVERSION_BUFFER_SIZE > _vectSize) ?
+                      CONVERSION_BUFFER_SIZE : _vectSize;
+    delete [] _pCodeBuffer;
+    _pCodeBuffer = new (std::nothrow) unsigned short[_codeBufferSize];
+    assertMemoryIsAllocated(_pCodeBuffer, __FILE__, __LINE__);
+    _dataVect.clear();
+    _dataCapacity = 0;
+    if (_compression == FeatureFileCompression_FLOAT16)
+      writeCompressedHeader(0); // updated by close()
+  }
+  _headerWritten = true;
+}
+//-------------------------------------------------------------------------
+void W::writeCompressedHeader(unsigned long featureCount) // private
+{
+  writeString("ALIZECFF");
+  writeUInt4(COMPRESSED_VERSION);
+  writeUInt4(COMPRESSED_BOM);
+  writeUInt4(_compression == FeatureFileCompression_INT16 ?
+             COMPRESSED_INT16 : COMPRESSED_FLOAT16);
+  writeUInt4(_vectSize);
+  writeUInt4(featureCount);
+  char flags[8];
+  memset(flags, 0, sizeof(flags));
+  const String& s = _config.getParam_featureFlags().getString();
+  memcpy(flags, s.c_str(), s.length() < 8 ? s.length() : 8);
+  writeBytes(flags, sizeof(flags));
+  writeFloat((float)_config.getParam_sampleRate());
+  char reserved[COMPRESSED_HEADER_LENGTH-40];
+  memset(reserved, 0, sizeof(reserved));
+  writeBytes(reserved, sizeof(reserved));
+}
+//-------------------------------------------------------------------------
+void W::writeQuantizedFeatures() // private
+{
+  // offset = middle of the range of the dimension,
+  // scale = range / 65534 -> codes in [-32767, 32767]
+  FloatVector scaleVect(_vectSize, _vectSize);
+  FloatVector offsetVect(_vectSize, _vectSize);
+  FloatVector minVect(_vectSize, _vectSize);
+  FloatVector maxVect(_vectSize, _vectSize);
+  const float* p = _dataVect.getArray();
+  for (unsigned long i=0; i<_vectSize; i++)
+    minVect[i] = maxVect[i] = p[i];
+  for (unsigned long t=1; t<_featureCount; t++) // one pass over the data
+  {
+    const float* x = p + t*_vectSize;
+    for (unsigned long i=0; i<_vectSize; i++)
     {
-      const FeatureFlags flags = _config.getParam_featureFlags();
-      unsigned long dim = 0;
-      const String& s = flags.getString();
-      if (s == "100000")
-        dim = _vectSize;
-      else if (s == "110000")
-        dim = _vectSize-1;
-      else if (s == "101000")
-        dim = _vectSize/2;
-      else if (s == "111000" || s == "101100")
-        dim = (_vectSize-1)/2;
-      else if (s == "111100")
-        dim = (_vectSize-2)/2;
-      else if (s == "100010")
-        dim = _vectSize/2;
-      else if (s == "110010")
-        dim = (_vectSize-1)/2;
-      else if (s == "101010")
-        dim = _vectSize/3;
-      else if (s == "111010" || s == "101110")
-        dim = (_vectSize-1)/3;
-      else if (s == "111110")
-        dim = (_vectSize-2)/3;
-      else if (s == "100011")
-        dim = (_vectSize-1)/2;
-      else if (s == "110011")
-        dim = (_vectSize-2)/2;
-      else if (s == "101011")
-        dim = (_vectSize-1)/3;
-      else if (s == "111011" || s == "101111")
-        dim = (_vectSize-2)/3;
-      else if (s == "111111")
-        dim = (_vectSize-3)/3;
-      else
-        throw Exception("Wrong featureFlag : " + s,
-                 __FILE__, __LINE__);
-      writeUInt4(_config.getParam_saveFeatureFileSPro3DataKind());
-      writeUInt4(dim);
-      writeUInt4(0);
-      writeUInt4(flags.toSPro3());
-      _headerWritten = true;
-      _featureCount = 0;
+      if (x[i] < minVect[i])
+        minVect[i] = x[i];
+      if (x[i] > maxVect[i])
+        maxVect[i] = x[i];
     }
-    for (unsigned long i=0; i<_vectSize; i++)
-    { writeFloat((float)f[i]); }
-    _featureCount++;
   }
-  else if (_format == FeatureFileWriterFormat_SPRO4) // *******************************************
+  for (unsigned long i=0; i<_vectSize; i++)
   {
-    if (!_headerWritten)
+    offsetVect[i] = (float)(((double)minVect[i]+maxVect[i])/2.0);
+    scaleVect[i] = (float)(((double)maxVect[i]-minVect[i])/65534.0);
+  }
+  writeCompressedHeader(_featureCount);
+  for (unsigned long i=0; i<_vectSize; i++)
+    writeFloat(scaleVect[i]);
+  for (unsigned long i=0; i<_vectSize; i++)
+    writeFloat(offsetVect[i]);
+  short* q = reinterpret_cast<short*>(_pCodeBuffer);
+  for (unsigned long t=0; t<_featureCount; t++, p+=_vectSize)
+  {
+    for (unsigned long i=0; i<_vectSize; i++)
     {
-      writeString("<header>\n");
-      writeString("</header>\n");
-      writeShort((short)_vectSize);
-      writeUInt4(_config.getParam_featureFlags().toSPro4());
-      writeFloat((float)_config.getParam_sampleRate());
-      _headerWritten = true;
+      if (scaleVect[i] == 0.0)
+      {
+        q[i] = 0;
+        continue;
+      }
+      long v = lrint(((double)p[i]-offsetVect[i])/scaleVect[i]);
+      if (v > 32767)
+        v = 32767;
+      else if (v < -32767)
+        v = -32767;
+      q[i] = (short)v;
     }
-    for (unsigned long i=0; i<_vectSize; i++)
-    { writeFloat((float)f[i]); }
+    writeBytes(q, _vectSize*sizeof(short));
   }
-  else
-     ;
+  _dataVect.clear();
 }
 //-------------------------------------------------------------------------
 void W::close()
 {
-  if (_format == FeatureFileWriterFormat_SPRO3 && isOpen() && _headerWritten)
+  if (isOpen() && _headerWritten)
   {
-     // update feature count just before closing the file
-    if (::fseek(_pFileStruct, 4+4, SEEK_SET) != 0) // if error
-      throw IOException("", __FILE__, __LINE__, _fileName);
-    writeUInt4(_featureCount);
+    _headerWritten = false; // written again if the file is re-opened
+    if (_format == FeatureFileWriterFormat_SPRO3)
+    {
+      // update feature count just before closing the file
+      seek(4+4);
+      writeUInt4(_featureCount);
+    }
+    else if (_format == FeatureFileWriterFormat_COMPRESSED)
+    {
+      if (_compression == FeatureFileCompression_INT16)
+        writeQuantizedFeatures();
+      else
+      {
+        // update feature count just before closing the file
+        seek(COMPRESSED_COUNT_POSITION);
+        writeUInt4(_featureCount);
+      }
+    }
   }
   FileWriter::close();
 }
 //-------------------------------------------------------------------------
 String W::getClassName() const {return "FeatureFileWriter";}
 //-------------------------------------------------------------------------
-W::~FeatureFileWriter() { close(); }
+W::~FeatureFileWriter()
+{
+  try { close(); }
+  catch (Exception&) {} // a destructor must not throw
+  delete [] _pCodeBuffer;
+}
 //-------------------------------------------------------------------------
 #endif // !defined(ALIZE_FeatureFileWriterFormat_cpp)
 
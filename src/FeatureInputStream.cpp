@@ -58,6 +58,8 @@
 #include "FeatureInputStream.h"
 #include "Exception.h"
 #include "Feature.h"
+#include "FeatureBlock.h"
+#include "FloatFeatureBlock.h"
 #include "LabelServer.h"
 #include "Config.h"
 
@@ -97,6 +99,56 @@ S::Error FeatureInputStream::getError() { return _error; }
 bool FeatureInputStream::writeFeature(const Feature& f, unsigned long step)
 { throw Exception("Feature writing forbidden", __FILE__, __LINE__); }
 //-------------------------------------------------------------------------
+unsigned long S::readFeatureView(FloatFeatureBlock& b, unsigned long n)
+{
+  // default behaviour : the features are copied
+  b.setVectSize(getVectSize());
+  Feature f;
+  unsigned long count = 0, allocated = 0;
+  while (count < n && readFeature(f) && _error == NO_ERROR)
+  {
+    if (count == allocated) // the block grows geometrically
+    {
+      allocated = (n-count > 2*count+64) ? 2*count+64 : n;
+      b.setFeatureCount(allocated);
+    }
+    b.setFeature(f, count++);
+  }
+  b.setFeatureCount(count);
+  return count;
+}
+//-------------------------------------------------------------------------
+unsigned long S::readFeatures(FeatureBlock& b, unsigned long n)
+{
+  // default behaviour : one call of readFeature() per feature
+  const unsigned long first = prepareBlock(b);
+  Feature f;
+  unsigned long count = 0, allocated = 0;
+  while (count < n && readFeature(f) && _error == NO_ERROR)
+  {
+    if (count == allocated) // the block grows geometrically
+    {
+      allocated = (n-count > 2*count+64) ? 2*count+64 : n;
+      b.setFeatureCount(first+allocated);
+    }
+    b.setFeature(f, first+count++);
+  }
+  b.setFeatureCount(first+count);
+  return count;
+}
+//-------------------------------------------------------------------------
+unsigned long S::prepareBlock(FeatureBlock& b) // protected
+{
+  const unsigned long vectSize = getVectSize();
+  if (b.getFeatureCount() == 0)
+    b.setVectSize(vectSize);
+  else if (b.getVectSize() != vectSize)
+    throw Exception("block vectSize ("
+        + String::valueOf(b.getVectSize()) + ") != stream vectSize ("
+        + String::valueOf(vectSize) + ")", __FILE__, __LINE__);
+  return b.getFeatureCount();
+}
+//-------------------------------------------------------------------------
 S::~FeatureInputStream() {}
 //-------------------------------------------------------------------------
 
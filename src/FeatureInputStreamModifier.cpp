@@ -172,6 +172,45 @@ bool M::readFeature(Feature& f, unsigned long step)
   return ok;
 }
 //-------------------------------------------------------------------------
+unsigned long M::readFeatureView(FloatFeatureBlock& b, unsigned long n)
+{
+  if (_useMask)
+    return FeatureInputStream::readFeatureView(b, n); // copy
+  unsigned long count = _pInput->readFeatureView(b, n);
+  _error = _pInput->getError();
+  return count;
+}
+//-------------------------------------------------------------------------
+unsigned long M::readFeatures(FeatureBlock& b, unsigned long n)
+{
+  if (!_useMask)
+  {
+    unsigned long count = _pInput->readFeatures(b, n);
+    _error = _pInput->getError();
+    return count;
+  }
+  const unsigned long first = prepareBlock(b);
+  _block.clear();
+  const unsigned long count = _pInput->readFeatures(_block, n);
+  _error = _pInput->getError();
+  if (count == 0)
+    return 0;
+  const unsigned long sourceSize = _block.getVectSize();
+  const unsigned long* selectionVect = _selection.getArray();
+  for (unsigned long i=0; i<_selectionSize; i++)
+    if (selectionVect[i] >= sourceSize)
+      throw Exception("Invalid feature mask : " + _mask, __FILE__, __LINE__);
+  b.setFeatureCount(first+count);
+  for (unsigned long t=0; t<count; t++)
+  {
+    const FeatureBlock::data_t* src = _block.getFeatureVector(t);
+    FeatureBlock::data_t* dest = b.getFeatureVector(first+t);
+    for (unsigned long i=0; i<_selectionSize; i++)
+      dest[i] = src[selectionVect[i]];
+  }
+  return count;
+}
+//-------------------------------------------------------------------------
 bool M::addFeature(const Feature& f)
 {
   bool ok;
@@ -58,6 +58,7 @@
 #include <new>
 #include "FeatureMultipleFileReader.h"
 #include "Feature.h"
+#include "FeatureBlock.h"
 #include "Exception.h"
 #include "FeatureFlags.h"
 #include "LabelServer.h"
@@ -109,6 +110,35 @@ R& R::create(const XLine& list, const Config& c,
 //-------------------------------------------------------------------------
 bool R::readFeature(Feature& f, unsigned long s) { return rw(true, f, s); }
 //-------------------------------------------------------------------------
+unsigned long R::readFeatures(FeatureBlock& b, unsigned long n)
+{
+  prepareBlock(b);
+  // the first feature is read as usual (seek, historic, change of file)
+  Feature f;
+  if (n == 0 || !rw(true, f, 1) || _error != NO_ERROR)
+    return 0;
+  b.addFeature(f);
+  unsigned long count = 1;
+  bool seekNeeded = false;
+  while (count < n && _fileCounter < _fileCount)
+  {
+    FeatureFileReader& r = getReader(_fileCounter);
+    if (seekNeeded)
+      r.seekFeature(0);
+    count += r.readFeatures(b, n-count);
+    _error = r.getError();
+    if (_error != NO_ERROR)
+      break;
+    if (count < n) // end of the file
+    {
+      _fileCounter++;
+      seekNeeded = true;
+    }
+  }
+  _lastFeatureIndex += count-1;
+  return count;
+}
+//-------------------------------------------------------------------------
 bool R::addFeature(const Feature& f) { throw Exception ("featureMultipleFileReader::addFeature not yet implemented", __FILE__, __LINE__); }
 //-------------------------------------------------------------------------
 bool R::writeFeature(const Feature& f, unsigned long step)
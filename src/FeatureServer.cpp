@@ -252,6 +252,24 @@ bool S::readFeature(Feature& f, unsigned long step)
   return ok;
 }
 //-------------------------------------------------------------------------
+unsigned long S::readFeatureView(FloatFeatureBlock& b, unsigned long n)
+{
+  if (_pInputStream == NULL)
+    return 0;
+  unsigned long count = inputStream().readFeatureView(b, n);
+  _error = inputStream().getError();
+  return count;
+}
+//-------------------------------------------------------------------------
+unsigned long S::readFeatures(FeatureBlock& b, unsigned long n)
+{
+  if (_pInputStream == NULL)
+    return 0;
+  unsigned long count = inputStream().readFeatures(b, n);
+  _error = inputStream().getError();
+  return count;
+}
+//-------------------------------------------------------------------------
 bool S::addFeature(const Feature& f)
 {
   if (_pInputStream == NULL)
@@ -60,6 +60,12 @@
 #endif
 
 #include <new>
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
 #include "FileReader.h"
 #include "Exception.h"
 #include "RealVector.h"
@@ -73,7 +79,8 @@ R::FileReader(const FileName& f, const String& path,
               const String& extension, bool swap)
 :Object(), _fullFileName(path + f + extension), _pFileStruct(NULL),
  _fileName(f), _path(path), _extension(extension), 
- _fileLengthDefined(false), _swap(swap) {}
+ _fileLengthDefined(false), _swap(swap), _pMapping(NULL),
+ _mappingIsSequential(true) {}
 //-------------------------------------------------------------------------
 R& R::create(const FileName& f, const String& path, const String& ext,
              bool swap)
@@ -103,6 +110,7 @@ void R::open()
 //-------------------------------------------------------------------------
 void R::close()
 {
+  unmap();
   if (isOpen())
     if (::fclose(_pFileStruct) == EOF)
       throw IOException("Cannot close file", __FILE__, __LINE__,
@@ -153,6 +161,55 @@ void R::seek(unsigned long pos) // protected
           __FILE__, __LINE__, _fullFileName);
 }
 //-------------------------------------------------------------------------
+const char* R::map(bool sequential)
+{
+  unmap();
+#if !defined(_WIN32)
+  int fd = ::open(_fullFileName.c_str(), O_RDONLY);
+  if (fd == -1)
+    throw FileNotFoundException("", __FILE__, __LINE__, _fullFileName);
+  struct stat st;
+  if (::fstat(fd, &st) == 0 && st.st_size > 0)
+  {
+    void* p = ::mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (p != MAP_FAILED)
+    {
+      _pMapping = p;
+      _fileLength = st.st_size;
+      _fileLengthDefined = true;
+      _mappingIsSequential = !sequential; // forces the advice
+      adviseMapping(sequential);
+    }
+  }
+  ::close(fd); // the mapping stays valid
+#endif
+  return getMapping();
+}
+//-------------------------------------------------------------------------
+void R::adviseMapping(bool sequential)
+{
+  if (_pMapping == NULL || sequential == _mappingIsSequential)
+    return;
+#if !defined(_WIN32)
+  // only a hint : errors are ignored
+  ::madvise(_pMapping, _fileLength,
+            sequential ? MADV_SEQUENTIAL : MADV_RANDOM);
+#endif
+  _mappingIsSequential = sequential;
+}
+//-------------------------------------------------------------------------
+const char* R::getMapping() const
+{ return static_cast<const char*>(_pMapping); }
+//-------------------------------------------------------------------------
+void R::unmap()
+{
+#if !defined(_WIN32)
+  if (_pMapping != NULL)
+    ::munmap(_pMapping, _fileLength);
+#endif
+  _pMapping = NULL;
+}
+//-------------------------------------------------------------------------
 void R::read(void* buffer, unsigned long length) // private
 {
   assert(buffer != NULL); // TODO : if public method, throw an Exception ?
@@ -246,6 +303,9 @@ double R::readDouble()
   return s;
 }
 //-------------------------------------------------------------------------
+void R::readBytes(void* buffer, unsigned long length)
+{ read(buffer, length); } // can throw IOException, EOFException
+//-------------------------------------------------------------------------
 FloatVector& R::readFloats(FloatVector& v)
 {
   if (_swap)
@@ -285,6 +345,18 @@ unsigned long R::readSomeFloats(FloatVector& v)
   return n;
 }
 //-------------------------------------------------------------------------
+unsigned long R::readSomeBytes(void* buffer, unsigned long length)
+{
+  assert(buffer != NULL);
+  if (isClosed())
+    open(); // can throw Exception if file name = ""
+  unsigned long n = (unsigned long)(::fread(buffer, 1, length,
+                                            _pFileStruct));
+  if (n < length && ferror(_pFileStruct))
+    throw IOException("Cannot read file", __FILE__, __LINE__, _fullFileName);
+  return n;
+}
+//-------------------------------------------------------------------------
 float R::readFloat()
 {
   float s;
@@ -59,14 +59,68 @@
 #define _CRT_SECURE_NO_WARNINGS
 #endif
 
+#include <new>
+#include <memory.h>
+#if defined(THREAD)
+#include <pthread.h>
+#endif
 #include "FileWriter.h"
 #include "Exception.h"
 
 using namespace alize;
 
+static const unsigned long WRITE_BUFFER_SIZE = 64*1024;
+static const unsigned long BACKGROUND_BUFFER_SIZE = 1024*1024;
+
+//-------------------------------------------------------------------------
+// Thread writing the blocks in the background. It runs from the opening
+// to the closing of the file and writes one block at a time : the block
+// is given in pBuffer and the thread sets pBuffer to NULL when done.
+struct FileWriter::BackgroundFlush
+{
+#if defined(THREAD)
+  pthread_t       thread;
+  pthread_mutex_t mutex;
+  pthread_cond_t  cond; // signaled when pBuffer or stop change
+#endif
+  FILE*         pFile;
+  const char*   pBuffer; // block to write, NULL if none
+  unsigned long length;
+  bool          failed;  // a block could not be written
+  bool          stop;
+
+  static void* run(void* p)
+  {
+#if defined(THREAD)
+    BackgroundFlush& b = *static_cast<BackgroundFlush*>(p);
+    pthread_mutex_lock(&b.mutex);
+    for (;;)
+    {
+      while (b.pBuffer == NULL && !b.stop)
+        pthread_cond_wait(&b.cond, &b.mutex);
+      if (b.pBuffer == NULL) // stop
+        break;
+      pthread_mutex_unlock(&b.mutex);
+      const bool failed = (::fwrite(b.pBuffer, b.length, 1, b.pFile) != 1);
+      pthread_mutex_lock(&b.mutex);
+      if (failed)
+        b.failed = true;
+      b.pBuffer = NULL;
+      pthread_cond_broadcast(&b.cond);
+    }
+    pthread_mutex_unlock(&b.mutex);
+#else
+    (void)p;
+#endif
+    return NULL;
+  }
+};
+
 //-------------------------------------------------------------------------
 FileWriter::FileWriter(const FileName& f)
-:Object(), _pFileStruct(NULL) , _fileName(f), _swap(false){}
+:Object(), _pFileStruct(NULL) , _fileName(f), _swap(false),
+ _pBuffer(NULL), _bufferLength(0), _bufferSize(0), _pFlushBuffer(NULL),
+ _pBackgroundFlush(NULL), _backgroundFlush(false) {}
 //-------------------------------------------------------------------------
 bool FileWriter::isClosed() const { return _pFileStruct == NULL; }
 //-------------------------------------------------------------------------
@@ -82,78 +136,238 @@ void FileWriter::open()
   if (_pFileStruct == NULL)
     throw IOException("Cannot create new file", __FILE__, __LINE__,
                _fileName);
+  _bufferLength = 0;
+  if (_backgroundFlush)
+    startBackgroundFlush();
 }
 //-------------------------------------------------------------------------
 void FileWriter::close()
 {
   if (isOpen())
+  {
+    try
+    {
+      flush();
+      stopBackgroundFlush();
+    }
+    catch (Exception&)
+    {
+      try { stopBackgroundFlush(); }
+      catch (Exception&) {} // the first error is reported
+      ::fclose(_pFileStruct);
+      _pFileStruct = NULL;
+      throw;
+    }
     if (::fclose(_pFileStruct) == EOF)
       throw IOException("Cannot close file", __FILE__, __LINE__,
                  _fileName);
+  }
   _pFileStruct = NULL;
 }
 //-------------------------------------------------------------------------
-void FileWriter::writeUInt4(unsigned long v)
+void FileWriter::setBackgroundFlush(bool on)
 {
-  assert(_pFileStruct != NULL);
-  if (sizeof(unsigned int) == 4)
+#if defined(THREAD)
+  if (on == _backgroundFlush)
+    return;
+  if (isOpen())
   {
-    if (::fwrite(&v, sizeof(unsigned int), 1, _pFileStruct) != 1)
-      throw IOException("Cannot write in file", __FILE__, __LINE__,
-                 _fileName);
+    flush();
+    stopBackgroundFlush();
   }
-  else if (sizeof(unsigned long) == 4)
+  freeBuffers(); // the size of the buffers depends on the mode
+  _backgroundFlush = on;
+  if (on && isOpen())
+    startBackgroundFlush();
+#else
+  (void)on;
+#endif
+}
+//-------------------------------------------------------------------------
+void FileWriter::allocateBuffers() // private
+{
+  assert(_pBuffer == NULL);
+  _bufferSize = _backgroundFlush ? BACKGROUND_BUFFER_SIZE
+                                 : WRITE_BUFFER_SIZE;
+  _pBuffer = new (std::nothrow) char[_bufferSize];
+  assertMemoryIsAllocated(_pBuffer, __FILE__, __LINE__);
+  if (_backgroundFlush)
   {
-    if (::fwrite(&v, sizeof(v), 1, _pFileStruct) != 1)
-      throw IOException("Cannot write in file", __FILE__, __LINE__,
-                _fileName);
+    _pFlushBuffer = new (std::nothrow) char[_bufferSize];
+    assertMemoryIsAllocated(_pFlushBuffer, __FILE__, __LINE__);
   }
-  else
-    return; // TODO : what to do ?
+  _bufferLength = 0;
 }
 //-------------------------------------------------------------------------
-void FileWriter::writeDouble(double v)
+void FileWriter::freeBuffers() // private
 {
-  assert(_pFileStruct != NULL);
-  if (::fwrite(&v, sizeof(v), 1, _pFileStruct) != 1)
+  assert(_bufferLength == 0 && _pBackgroundFlush == NULL);
+  delete [] _pBuffer;
+  delete [] _pFlushBuffer;
+  _pBuffer = NULL;
+  _pFlushBuffer = NULL;
+  _bufferSize = 0;
+}
+//-------------------------------------------------------------------------
+void FileWriter::writeFile(const void* buffer, unsigned long length)
+{ // private
+  if (::fwrite(buffer, length, 1, _pFileStruct) != 1)
     throw IOException("Cannot write in file", __FILE__, __LINE__,
                _fileName);
 }
 //-------------------------------------------------------------------------
-void FileWriter::writeFloat(float v)
+void FileWriter::flushBuffer() // private
 {
-  assert(_pFileStruct != NULL);
-  if (::fwrite(&v, sizeof(v), 1, _pFileStruct) != 1)
+  const unsigned long length = _bufferLength;
+  if (length == 0)
+    return;
+  _bufferLength = 0;
+#if defined(THREAD)
+  if (_pBackgroundFlush != NULL)
+  {
+    waitBackgroundFlush(); // _pFlushBuffer is free
+    char* p = _pFlushBuffer;
+    _pFlushBuffer = _pBuffer;
+    _pBuffer = p;
+    BackgroundFlush& b = *_pBackgroundFlush;
+    pthread_mutex_lock(&b.mutex);
+    b.pBuffer = _pFlushBuffer;
+    b.length = length;
+    pthread_cond_broadcast(&b.cond);
+    pthread_mutex_unlock(&b.mutex);
+    return;
+  }
+#endif
+  writeFile(_pBuffer, length);
+}
+//-------------------------------------------------------------------------
+void FileWriter::startBackgroundFlush() // private
+{
+#if defined(THREAD)
+  assert(_pBackgroundFlush == NULL && _pFileStruct != NULL);
+  BackgroundFlush* b = new (std::nothrow) BackgroundFlush;
+  assertMemoryIsAllocated(b, __FILE__, __LINE__);
+  b->pFile = _pFileStruct;
+  b->pBuffer = NULL;
+  b->length = 0;
+  b->failed = false;
+  b->stop = false;
+  pthread_mutex_init(&b->mutex, NULL);
+  pthread_cond_init(&b->cond, NULL);
+  if (pthread_create(&b->thread, NULL, BackgroundFlush::run, b) == 0)
+    _pBackgroundFlush = b;
+  else // the blocks are written synchronously
+  {
+    pthread_cond_destroy(&b->cond);
+    pthread_mutex_destroy(&b->mutex);
+    delete b;
+  }
+#endif
+}
+//-------------------------------------------------------------------------
+void FileWriter::stopBackgroundFlush() // private
+{
+#if defined(THREAD)
+  if (_pBackgroundFlush == NULL)
+    return;
+  BackgroundFlush* b = _pBackgroundFlush;
+  _pBackgroundFlush = NULL;
+  pthread_mutex_lock(&b->mutex);
+  b->stop = true; // the pending block is written first
+  pthread_cond_broadcast(&b->cond);
+  pthread_mutex_unlock(&b->mutex);
+  pthread_join(b->thread, NULL);
+  const bool failed = b->failed;
+  pthread_cond_destroy(&b->cond);
+  pthread_mutex_destroy(&b->mutex);
+  delete b;
+  if (failed)
     throw IOException("Cannot write in file", __FILE__, __LINE__,
                _fileName);
+#endif
 }
 //-------------------------------------------------------------------------
-void FileWriter::writeShort(short v)
+void FileWriter::waitBackgroundFlush() // private
 {
-  assert(_pFileStruct != NULL);
-  if (::fwrite(&v, sizeof(v), 1, _pFileStruct) != 1)
+#if defined(THREAD)
+  if (_pBackgroundFlush == NULL)
+    return;
+  BackgroundFlush& b = *_pBackgroundFlush;
+  pthread_mutex_lock(&b.mutex);
+  while (b.pBuffer != NULL)
+    pthread_cond_wait(&b.cond, &b.mutex);
+  const bool failed = b.failed;
+  b.failed = false;
+  pthread_mutex_unlock(&b.mutex);
+  if (failed)
     throw IOException("Cannot write in file", __FILE__, __LINE__,
                _fileName);
+#endif
 }
 //-------------------------------------------------------------------------
-void FileWriter::writeChar(char v)
+void FileWriter::flush()
 {
   assert(_pFileStruct != NULL);
-  if (::fwrite(&v, sizeof(v), 1, _pFileStruct) != 1)
-    throw IOException("Cannot write in file", __FILE__, __LINE__,
+  flushBuffer();
+  waitBackgroundFlush();
+}
+//-------------------------------------------------------------------------
+void FileWriter::seek(unsigned long pos)
+{
+  flush();
+  if (::fseek(_pFileStruct, pos, SEEK_SET) != 0)
+    throw IOException("Cannot seek in file", __FILE__, __LINE__,
                _fileName);
 }
 //-------------------------------------------------------------------------
-void FileWriter::writeString(const String& string)
+void FileWriter::writeBytes(const void* buffer, unsigned long length)
 {
-  if (string.isEmpty())
+  if (length == 0)
     return;
   assert(_pFileStruct != NULL);
-  if (::fwrite(string.c_str(), string.length(), 1, _pFileStruct) != 1)
-    throw IOException("Cannot write in file", __FILE__, __LINE__,
-               _fileName);
+  const char* p = static_cast<const char*>(buffer);
+  if (_pBuffer == NULL)
+    allocateBuffers();
+  while (length != 0)
+  {
+    if (_bufferLength == 0 && length >= _bufferSize && !_backgroundFlush)
+    {
+      writeFile(p, length); // large block : no copy
+      return;
+    }
+    unsigned long n = _bufferSize - _bufferLength;
+    if (n > length)
+      n = length;
+    memcpy(_pBuffer+_bufferLength, p, n);
+    _bufferLength += n;
+    p += n;
+    length -= n;
+    if (_bufferLength == _bufferSize)
+      flushBuffer();
+  }
+}
+//-------------------------------------------------------------------------
+void FileWriter::writeUInt4(unsigned long v)
+{
+  if (sizeof(unsigned int) == 4)
+    writeBytes(&v, sizeof(unsigned int));
+  else if (sizeof(unsigned long) == 4)
+    writeBytes(&v, sizeof(v));
+  else
+    return; // TODO : what to do ?
 }
 //-------------------------------------------------------------------------
+void FileWriter::writeDouble(double v) { writeBytes(&v, sizeof(v)); }
+//-------------------------------------------------------------------------
+void FileWriter::writeFloat(float v) { writeBytes(&v, sizeof(v)); }
+//-------------------------------------------------------------------------
+void FileWriter::writeShort(short v) { writeBytes(&v, sizeof(v)); }
+//-------------------------------------------------------------------------
+void FileWriter::writeChar(char v) { writeBytes(&v, sizeof(v)); }
+//-------------------------------------------------------------------------
+void FileWriter::writeString(const String& string)
+{ writeBytes(string.c_str(), string.length()); }
+//-------------------------------------------------------------------------
 void FileWriter::writeAttribute(const String& name, const String& value)
 {
   //assert(false); // transformer les < > &... idem pour FileReader
@@ -217,7 +431,12 @@ void FileWriter::swap8Bytes(void *src, void *dest)
 //-------------------------------------------------------------------------
 String FileWriter::getClassName() const { return "FileWriter"; }
 //-------------------------------------------------------------------------
-FileWriter::~FileWriter() { close(); }
+FileWriter::~FileWriter()
+{
+  try { close(); }
+  catch (Exception&) {} // a destructor must not throw
+  freeBuffers();
+}
 //-------------------------------------------------------------------------
 
 #endif // !defined(ALIZE_FileWriter_cpp)
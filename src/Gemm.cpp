@@ -0,0 +1,163 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+#if !defined(ALIZE_Gemm_cpp)
+#define ALIZE_Gemm_cpp
+
+#include "Gemm.h"
+#if defined(HAVE_CBLAS)
+extern "C" {
+#include <cblas.h>
+}
+#endif
+
+using namespace alize;
+
+// sizes of the blocks of the internal implementation. A block of b
+// (GEMM_BLOCK_N rows of GEMM_BLOCK_K values) stays in the L2 cache while
+// it is multiplied by all the rows of a
+static const unsigned long GEMM_BLOCK_N = 64;
+static const unsigned long GEMM_BLOCK_K = 256;
+
+//-------------------------------------------------------------------------
+// c[4x4] += a[4xk] * transpose(b[4xk])
+static inline void kernel4x4(unsigned long k, const real_t* a,
+                 unsigned long lda, const real_t* b, unsigned long ldb,
+                 real_t* c, unsigned long ldc)
+{
+  real_t c00=0, c01=0, c02=0, c03=0, c10=0, c11=0, c12=0, c13=0;
+  real_t c20=0, c21=0, c22=0, c23=0, c30=0, c31=0, c32=0, c33=0;
+  const real_t* a0 = a;
+  const real_t* a1 = a+lda;
+  const real_t* a2 = a+2*lda;
+  const real_t* a3 = a+3*lda;
+  const real_t* b0 = b;
+  const real_t* b1 = b+ldb;
+  const real_t* b2 = b+2*ldb;
+  const real_t* b3 = b+3*ldb;
+  for (unsigned long l=0; l<k; l++)
+  {
+    c00 += a0[l]*b0[l]; c01 += a0[l]*b1[l];
+    c02 += a0[l]*b2[l]; c03 += a0[l]*b3[l];
+    c10 += a1[l]*b0[l]; c11 += a1[l]*b1[l];
+    c12 += a1[l]*b2[l]; c13 += a1[l]*b3[l];
+    c20 += a2[l]*b0[l]; c21 += a2[l]*b1[l];
+    c22 += a2[l]*b2[l]; c23 += a2[l]*b3[l];
+    c30 += a3[l]*b0[l]; c31 += a3[l]*b1[l];
+    c32 += a3[l]*b2[l]; c33 += a3[l]*b3[l];
+  }
+  c[0] += c00; c[1] += c01; c[2] += c02; c[3] += c03; c += ldc;
+  c[0] += c10; c[1] += c11; c[2] += c12; c[3] += c13; c += ldc;
+  c[0] += c20; c[1] += c21; c[2] += c22; c[3] += c23; c += ldc;
+  c[0] += c30; c[1] += c31; c[2] += c32; c[3] += c33;
+}
+//-------------------------------------------------------------------------
+// c[i][j] += a[i] . b[j] for the rows not handled by kernel4x4()
+static inline void kernel1x1(unsigned long k, const real_t* a,
+                             const real_t* b, real_t* c)
+{
+  real_t s = 0.0;
+  for (unsigned long l=0; l<k; l++)
+    s += a[l]*b[l];
+  *c += s;
+}
+//-------------------------------------------------------------------------
+void Gemm::multiplyByTransposed(unsigned long m, unsigned long n,
+           unsigned long k, const real_t* a, unsigned long lda,
+           const real_t* b, unsigned long ldb, real_t* c, unsigned long ldc)
+{
+  if (m == 0 || n == 0)
+    return;
+#if defined(HAVE_CBLAS)
+  cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasTrans, (int)m, (int)n,
+              (int)k, 1.0, a, (int)lda, b, (int)ldb, 0.0, c, (int)ldc);
+#else
+  unsigned long i, j;
+  for (i=0; i<m; i++)
+    for (j=0; j<n; j++)
+      c[i*ldc+j] = 0.0;
+  for (unsigned long l0=0; l0<k; l0+=GEMM_BLOCK_K)
+  {
+    const unsigned long kb = (k-l0 < GEMM_BLOCK_K) ? k-l0 : GEMM_BLOCK_K;
+    for (unsigned long j0=0; j0<n; j0+=GEMM_BLOCK_N)
+    {
+      const unsigned long j1 = (n-j0 < GEMM_BLOCK_N) ? n : j0+GEMM_BLOCK_N;
+      const unsigned long j4 = j0 + ((j1-j0) & ~3UL);
+      for (i=0; i+4<=m; i+=4)
+      {
+        for (j=j0; j<j4; j+=4)
+          kernel4x4(kb, a+i*lda+l0, lda, b+j*ldb+l0, ldb, c+i*ldc+j, ldc);
+        for (; j<j1; j++)
+          for (unsigned long ii=i; ii<i+4; ii++)
+            kernel1x1(kb, a+ii*lda+l0, b+j*ldb+l0, c+ii*ldc+j);
+      }
+      for (; i<m; i++)
+        for (j=j0; j<j1; j++)
+          kernel1x1(kb, a+i*lda+l0, b+j*ldb+l0, c+i*ldc+j);
+    }
+  }
+#endif
+}
+//-------------------------------------------------------------------------
+String Gemm::getImplementationName()
+{
+#if defined(HAVE_CBLAS)
+  return "cblas";
+#else
+  return "internal";
+#endif
+}
+//-------------------------------------------------------------------------
+
+#endif // !defined(ALIZE_Gemm_cpp)
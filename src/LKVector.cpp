@@ -60,6 +60,7 @@
 #include <memory.h>
 #include <cstdlib>
 #include "LKVector.h"
+#include "SimdKernels.h"
 #include "alizeString.h"
 #include "Exception.h"
 
@@ -178,15 +179,85 @@ int LKVector::compare(const void *s1, const void *s2) // static method
     return -1;
   if (((type*)s1)->lk < ((type*)s2)->lk)
     return 1;
+  if (((type*)s1)->idx < ((type*)s2)->idx)
+    return -1;
+  if (((type*)s1)->idx > ((type*)s2)->idx)
+    return 1;
   return 0;
 }
 //-------------------------------------------------------------------------
+// true if a is before b in a descending sort
+bool LKVector::isBefore(const type& a, const type& b) // static private
+{ return a.lk > b.lk || (a.lk == b.lk && a.idx < b.idx); }
+//-------------------------------------------------------------------------
+// restores the heap property from index i. The root of the heap is the
+// last value in the descending order
+void LKVector::siftDown(type* h, unsigned long n, unsigned long i)
+{ // static private
+  type v = h[i];
+  for (;;)
+  {
+    unsigned long c = 2*i+1;
+    if (c >= n)
+      break;
+    if (c+1 < n && isBefore(h[c], h[c+1]))
+      c++;
+    if (!isBefore(v, h[c]))
+      break;
+    h[i] = h[c];
+    i = c;
+  }
+  h[i] = v;
+}
+//-------------------------------------------------------------------------
 void LKVector::descendingSort() const
 {
   assert(_array != NULL);
   qsort(_array, _size, sizeof(type), compare);
 }
 //-------------------------------------------------------------------------
+void LKVector::descendingPartialSort(unsigned long n) const
+{
+  assert(_array != NULL);
+  if (n >= _size)
+  {
+    descendingSort();
+    return;
+  }
+  if (n == 0)
+    return;
+  unsigned long i;
+  // heap of the n best values found so far, the worst one at the root
+  for (i=n/2; i>0; i--)
+    siftDown(_array, n, i-1);
+
+  const unsigned long stride = sizeof(type)/sizeof(lk_t);
+  for (i=n; i<_size; i++)
+  {
+    // skips the values lower than the worst selected one
+    i += SimdKernels::findGreaterOrEqual(&_array[i].lk, _size-i, stride,
+                                         _array[0].lk);
+    if (i == _size)
+      break;
+    if (isBefore(_array[i], _array[0]))
+    {
+      // swaps to keep all the values in the vector
+      type tmp = _array[0];
+      _array[0] = _array[i];
+      _array[i] = tmp;
+      siftDown(_array, n, 0);
+    }
+  }
+  // heap sort of the selection
+  for (i=n-1; i>0; i--)
+  {
+    type tmp = _array[0];
+    _array[0] = _array[i];
+    _array[i] = tmp;
+    siftDown(_array, i, 0);
+  }
+}
+//-------------------------------------------------------------------------
 LKVector::type* LKVector::getArray() const { return _array; }
 //-------------------------------------------------------------------------
 void LKVector::clear() { _size = 0; }
@@ -64,10 +64,36 @@
 
 using namespace alize;
 
+static const unsigned long EMPTY_SLOT = ~0UL;
+
+//-------------------------------------------------------------------------
+// FNV-1a
+static unsigned long hashString(const String& s, unsigned long h)
+{
+  const char* p = s.c_str();
+  const unsigned long n = s.length();
+  for (unsigned long i=0; i<n; i++)
+  {
+    h ^= (unsigned char)p[i];
+    h = (h*16777619UL) & 0xFFFFFFFFUL;
+  }
+  return h;
+}
+//-------------------------------------------------------------------------
+static unsigned long hashKey(const String& s, const String* pSrcName)
+{
+  unsigned long h = hashString(s, 2166136261UL);
+  if (pSrcName != NULL)
+    h = hashString(*pSrcName, (h ^ 0xFF)*16777619UL & 0xFFFFFFFFUL);
+  return h;
+}
+
 //-------------------------------------------------------------------------
 LabelServer::LabelServer(bool usePredefinedLabels)
-:Object(), _first(0), _lastAdded(0)
+:Object(), _first(0), _lastAdded(0), _labelIndexCount(0),
+ _stringIndexCount(0)
 {
+  rebuildIndex(16);
   if (usePredefinedLabels)
   {
     addLabel(Label(""));
@@ -86,26 +112,83 @@ unsigned long LabelServer::addLabel(const Label& l, bool forceAdd)
     if (l == getLabel(_lastAdded)) // operator!= overloaded
       return _lastAdded;
     // search for an identical label
-    unsigned long s = size();
-    for (unsigned long i=0; i<s; i++)
+    unsigned long i = _labelIndex[findSlot(_labelIndex, l.getString(),
+                                           &l.getSourceName())];
+    if (i != EMPTY_SLOT) // if an identical label exists
     {
-      if (getLabel(i) == l) // if an identical label exists
-      {
-        _lastAdded = i;
-        return _lastAdded;
-      }
+      _lastAdded = i;
+      return _lastAdded;
     }
   }
   // adds a new label
   _vect.addObject(l.duplicate());
   _lastAdded = size()-1;
+  addToIndex(_lastAdded);
   return _lastAdded;
 }
 //-------------------------------------------------------------------------
+unsigned long LabelServer::findSlot(const ULongVector& table,
+          const String& s, const String* pSrcName) const // private
+{
+  // returns the slot of the first label with this key, or an empty slot
+  const unsigned long* t = table.getArray();
+  const unsigned long mask = table.size()-1;
+  unsigned long j = hashKey(s, pSrcName) & mask;
+  while (t[j] != EMPTY_SLOT)
+  {
+    const Label& l = getLabel(t[j]);
+    if (l.getString() == s &&
+        (pSrcName == NULL || l.getSourceName() == *pSrcName))
+      return j;
+    j = (j+1) & mask;
+  }
+  return j;
+}
+//-------------------------------------------------------------------------
+void LabelServer::addToIndex(unsigned long i) const // private
+{
+  // the tables are kept at most half full
+  if (2*(_labelIndexCount+1) > _labelIndex.size() ||
+      2*(_stringIndexCount+1) > _stringIndex.size())
+  {
+    rebuildIndex(2*_labelIndex.size()); // indexes all the labels
+    return;
+  }
+  const Label& l = getLabel(i);
+  unsigned long j = findSlot(_labelIndex, l.getString(), &l.getSourceName());
+  if (_labelIndex[j] == EMPTY_SLOT) // the first identical label is kept
+  {
+    _labelIndex[j] = i;
+    _labelIndexCount++;
+  }
+  j = findSlot(_stringIndex, l.getString(), NULL);
+  if (_stringIndex[j] == EMPTY_SLOT)
+  {
+    _stringIndex[j] = i;
+    _stringIndexCount++;
+  }
+}
+//-------------------------------------------------------------------------
+void LabelServer::rebuildIndex(unsigned long tableSize) const // private
+{
+  unsigned long n = 16; // power of 2
+  while (n < tableSize || n < 2*(size()+1))
+    n *= 2;
+  _labelIndex.setSize(n);
+  _stringIndex.setSize(n);
+  for (unsigned long j=0; j<n; j++)
+    _labelIndex[j] = _stringIndex[j] = EMPTY_SLOT;
+  _labelIndexCount = _stringIndexCount = 0;
+  const unsigned long s = size();
+  for (unsigned long i=0; i<s; i++)
+    addToIndex(i);
+}
+//-------------------------------------------------------------------------
 void LabelServer::setLabel(const Label& l, unsigned long i) const
 {
   delete &_vect.getObject(i); // can throw IndexOutOfBoundsException
   _vect.setObject(l.duplicate(), i);
+  rebuildIndex(_labelIndex.size());
 }
 //-------------------------------------------------------------------------
 Label& LabelServer::getLabel(unsigned long index) const
@@ -116,11 +199,10 @@ Label& LabelServer::getLabel(unsigned long index) const
 //-------------------------------------------------------------------------
 long LabelServer::getLabelIndexByString(const String& s) const
 {
-  unsigned long size = _vect.size();
-  for (unsigned long i=0; i<size; i++)
-    if (_vect.getObject(i).getString() == s)
-      return (long)i;
-  return -1;
+  unsigned long i = _stringIndex[findSlot(_stringIndex, s, NULL)];
+  if (i == EMPTY_SLOT)
+    return -1;
+  return (long)i;
 }
 //-------------------------------------------------------------------------
 void LabelServer::clear(bool deletePreDefined)
@@ -128,6 +210,8 @@ void LabelServer::clear(bool deletePreDefined)
   if (deletePreDefined)
     _first = 0;
   _vect.deleteAllObjects(_first);
+  _lastAdded = 0;
+  rebuildIndex(16);
 }
 //-------------------------------------------------------------------------
 unsigned long LabelServer::size() const { return _vect.size(); }
@@ -68,7 +68,7 @@ typedef Mixture M;
 //-------------------------------------------------------------------------
 M::Mixture(const String& id, unsigned long distribCount, unsigned long v)
 :Object(), _vectSize(v), _weightVect(distribCount),
- _distribVect(distribCount), _id(id) {}
+ _distribVect(distribCount), _id(id), _stamp(Distrib::newStamp(K::k)) {}
 //-------------------------------------------------------------------------
 bool M::operator!=(const Mixture& m) const { return !(*this == m); }
 //-------------------------------------------------------------------------
@@ -114,6 +114,7 @@ void M::removeAllDistrib(const K&)
 {
   _distribVect.clear();
   _weightVect.clear();
+  _stamp = Distrib::newStamp(K::k);
 }
 //-------------------------------------------------------------------------
 Mixture& M::duplicate(const K&, DuplDistrib d) const
@@ -122,12 +123,14 @@ Mixture& M::duplicate(const K&, DuplDistrib d) const
 void M::setDistrib(const K&, Distrib& d, unsigned long i)
 {
   _distribVect.setDistrib(d, i); // can throw IndexOutOfBoundsException
+  _stamp = Distrib::newStamp(K::k);
 }
 //-------------------------------------------------------------------------
 void M::addDistrib(const K&, Distrib& d, weight_t w)
 {
   _distribVect.addDistrib(d);
   _weightVect.addValue(w);
+  _stamp = Distrib::newStamp(K::k);
 }
 //-------------------------------------------------------------------------
 Distrib& M::getDistrib(unsigned long i) const
@@ -136,7 +139,10 @@ Distrib& M::getDistrib(unsigned long i) const
 }
 //-------------------------------------------------------------------------
 weight_t& M::weight(unsigned long index)
-{ return _weightVect[index]; /* can throw IndexOutOfBoundsException */ }
+{
+  _stamp = Distrib::newStamp(K::k);
+  return _weightVect[index]; /* can throw IndexOutOfBoundsException */
+}
 //-------------------------------------------------------------------------
 weight_t M::weight(unsigned long index) const
 { return _weightVect[index]; /* can throw IndexOutOfBoundsException */}
@@ -144,7 +150,11 @@ weight_t M::weight(unsigned long index) const
 void M::save(const FileName& f, const Config& c) const
 { MixtureFileWriter(f, c).writeMixture(*this); }
 //-------------------------------------------------------------------------
-DoubleVector& M::getTabWeight() { return _weightVect; }
+DoubleVector& M::getTabWeight()
+{
+  _stamp = Distrib::newStamp(K::k);
+  return _weightVect;
+}
 //-------------------------------------------------------------------------
 const DoubleVector& M::getTabWeight() const { return _weightVect; }
 //-------------------------------------------------------------------------
@@ -168,6 +178,8 @@ void M::computeAll()
 //-------------------------------------------------------------------------
 unsigned long M::getVectSize() const { return _vectSize; }
 //-------------------------------------------------------------------------
+unsigned long M::getStamp() const { return _stamp; }
+//-------------------------------------------------------------------------
 // static method
 //-------------------------------------------------------------------------
 Mixture& M::create(const K&, const unsigned long dc,
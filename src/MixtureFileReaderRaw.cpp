@@ -56,6 +56,7 @@
 #define ALIZE_MixtureFileReaderRaw_cpp
 
 #include <new>
+#include <memory.h>
 #include "MixtureFileReaderRaw.h"
 #include "MixtureGD.h"
 #include "MixtureGF.h"
@@ -64,6 +65,7 @@
 #include "Exception.h"
 #include "Config.h"
 #include "FileReader.h"
+#include "SimdKernels.h"
 
 using namespace alize;
 typedef MixtureFileReaderRaw R;
@@ -107,38 +109,96 @@ const MixtureGD& R::readMixtureGD()
   // size of the vector
   unsigned long vectSize = _pReader->readInt4();
 
-  _pMixture = &MixtureGD::create(K::k, _pReader->getFileName(),
-                                 vectSize, distribCount);
+  // the rest of the file is mapped or read at once, then decoded in
+  // memory
+  const unsigned long length = _pReader->getFileLength() - 8;
+  DoubleVector buffer;
+  const char* p = _pReader->map(true);
+  if (p != NULL)
+    p += 8;
+  else
+  {
+    buffer.setSize(length/sizeof(real_t)+1);
+    _pReader->readBytes(buffer.getArray(), length);
+    p = reinterpret_cast<const char*>(buffer.getArray());
+  }
+  const char* end = p + length;
+  const bool swap = _pReader->swap();
+
+  MixtureGD& m = MixtureGD::create(K::k, _pReader->getFileName(),
+                                   vectSize, 0);
+  _pMixture = &m;
 
   // distribution weights
-  for (c=0; c<distribCount; c++)
-  { _pMixture->weight(c) = _pReader->readDouble(); }
+  if ((unsigned long)(end-p) < distribCount*sizeof(real_t))
+    eofError();
+  DoubleVector weightVect(distribCount, distribCount);
+  memcpy(weightVect.getArray(), p, distribCount*sizeof(real_t));
+  p += distribCount*sizeof(real_t);
+  if (swap)
+    SimdKernels::swap8Bytes(weightVect.getArray(), distribCount);
 
+  const unsigned long vectLength = vectSize*sizeof(real_t);
   for (c=0; c<distribCount; c++)
   {
-    DistribGD& d = static_cast<DistribGD&>(_pMixture->getDistrib(c));
-
-    // cst
-    d.setCst(K::k, _pReader->readDouble());
+    // cst, determinant and a flag for the covariance
+    real_t cstDet[2];
+    if (end-p < 17)
+      eofError();
+    memcpy(cstDet, p, 16);
+    if (swap)
+      SimdKernels::swap8Bytes(cstDet, 2);
+    const bool hasCov = (p[16] == (char)1);
+    p += 17;
+    if ((unsigned long)(end-p) < (hasCov ? 3 : 2)*vectLength)
+      eofError();
+    const char* pCov = p;
+    if (hasCov)
+      p += vectLength;
 
-    // determinant
-    d.setDet(K::k, _pReader->readDouble());
-
-    // covariance
-    if (_pReader->readChar() == (char)1)
-      for (v = 0; v < vectSize; v++)
-      { d.setCov(_pReader->readDouble(), v); }
+    // the distribution is not randomly initialized : all the parameters
+    // are set below
+    DistribGD& d = DistribGD::createUninitialized(K::k, vectSize);
+    m.addDistrib(K::k, d, weightVect[c]);
+    d.setCst(K::k, cstDet[0]);
+    d.setDet(K::k, cstDet[1]);
 
     // inverse covariance
-    for (v = 0; v < vectSize; v++)
-    { d.getCovInvVect()[v] = _pReader->readDouble(); }
+    real_t* covInvVect = d.getCovInvVect().getArray();
+    memcpy(covInvVect, p, vectLength);
+    p += vectLength;
 
     // mean
-    for (v = 0; v < vectSize; v++)
-    { d.setMean(_pReader->readDouble(), v); }
+    real_t* meanVect = d.getMeanVect().getArray();
+    memcpy(meanVect, p, vectLength);
+    p += vectLength;
+
+    if (swap)
+    {
+      SimdKernels::swap8Bytes(covInvVect, vectSize);
+      SimdKernels::swap8Bytes(meanVect, vectSize);
+    }
+
+    // covariance (not used by the current writer)
+    if (hasCov)
+      for (v = 0; v < vectSize; v++)
+      {
+        real_t x;
+        memcpy(&x, pCov+v*sizeof(real_t), sizeof(real_t));
+        if (swap)
+          SimdKernels::swap8Bytes(&x, 1);
+        d.setCov(x, v);
+      }
   }
   _pReader->close();
-  return *static_cast<MixtureGD*>(_pMixture);
+  return m;
+}
+//-------------------------------------------------------------------------
+void R::eofError() // private
+{
+  assert(_pReader != NULL);
+  _pReader->close();
+  throw EOFException("", __FILE__, __LINE__, _pReader->getFullFileName());
 }
 //-------------------------------------------------------------------------
 const MixtureGF& R::readMixtureGF()
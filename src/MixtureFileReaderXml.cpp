@@ -85,13 +85,13 @@ R& R::create(const FileName& f, const Config& c)
 //-------------------------------------------------------------------------
 const Mixture& R::readMixture()
 {
-  _line = 1;
   _idFound = false;
   _distribCountFound = false;
   _vectSizeFound = false;
   _typeFound = false;
 
-  parse();
+  assert(_pReader != NULL);
+  parse(*_pReader);
   _pReader->close();
   return *_pMixture;
 }
@@ -347,19 +347,10 @@ void R::eventError(const String& msg)
 {
   assert(_pReader != NULL);
   _pReader->close();
-  throw InvalidDataException("Error line " + String::valueOf(_line)
+  throw InvalidDataException("Error line " + String::valueOf(getLine())
     + " : " + msg, __FILE__, __LINE__, _pReader->getFullFileName());
 }
 //-------------------------------------------------------------------------
-const String& R::readOneChar()
-{
-  assert(_pReader != NULL);
-  const String& s = _pReader->readString(1);
-  if (s == "\n")
-    _line++;
-  return s;
-}
-//-------------------------------------------------------------------------
 Mixture& R::mixture() // private
 {
   if (_pMixture == NULL)
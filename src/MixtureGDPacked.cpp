@@ -0,0 +1,248 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+#if !defined(ALIZE_MixtureGDPacked_cpp)
+#define ALIZE_MixtureGDPacked_cpp
+
+#include <new>
+#include <cmath>
+#include <cstddef>
+#include <memory.h>
+#include "MixtureGDPacked.h"
+#include "MixtureGD.h"
+#include "DistribGD.h"
+#include "alizeString.h"
+#include "Exception.h"
+
+using namespace alize;
+typedef MixtureGDPacked P;
+
+//-------------------------------------------------------------------------
+P::MixtureGDPacked(const MixtureGD& m)
+:Object(), _pMixture(&m), _distribCount(0), _vectSize(0), _stride(0),
+ _floatStride(0), _stamp(0), _pBuffer(NULL), _meanMatr(NULL),
+ _covInvMatr(NULL), _gemmMatr(NULL), _pFloatBuffer(NULL),
+ _floatMeanMatr(NULL), _floatCovInvMatr(NULL)
+{ build(); }
+//-------------------------------------------------------------------------
+void P::build() // private
+{
+  const MixtureGD& m = *_pMixture;
+  _stamp = Distrib::getLastStamp();
+  _distribCount = m.getDistribCount();
+  _vectSize = m.getVectSize();
+  _stride = (_vectSize+7) & ~7UL; // 8 doubles = 64 bytes
+
+  delete [] _pBuffer;
+  _pBuffer = new (std::nothrow) real_t[4*_distribCount*_stride+8];
+  assertMemoryIsAllocated(_pBuffer, __FILE__, __LINE__);
+  real_t* p = _pBuffer;
+  while (reinterpret_cast<size_t>(p) % 64 != 0)
+    p++;
+  memset(p, 0, 4*_distribCount*_stride*sizeof(real_t));
+  _meanMatr = p;
+  _covInvMatr = p + _distribCount*_stride;
+  _gemmMatr = p + 2*_distribCount*_stride;
+
+  _floatStride = (_vectSize+15) & ~15UL; // 16 floats = 64 bytes
+  delete [] _pFloatBuffer;
+  _pFloatBuffer = new (std::nothrow) float[2*_distribCount*_floatStride+16];
+  assertMemoryIsAllocated(_pFloatBuffer, __FILE__, __LINE__);
+  float* q = _pFloatBuffer;
+  while (reinterpret_cast<size_t>(q) % 64 != 0)
+    q++;
+  memset(q, 0, 2*_distribCount*_floatStride*sizeof(float));
+  _floatMeanMatr = q;
+  _floatCovInvMatr = q + _distribCount*_floatStride;
+
+  _weightVect.setSize(_distribCount);
+  _cstVect.setSize(_distribCount);
+  _logWeightVect.setSize(_distribCount);
+  _logCstVect.setSize(_distribCount);
+  _logWeightCstVect.setSize(_distribCount);
+  _gemmCstVect.setSize(_distribCount);
+
+  for (unsigned long c=0; c<_distribCount; c++)
+  {
+    const DistribGD& d = m.getDistrib(c);
+    memcpy(_meanMatr+c*_stride, d.getMeanVect().getArray(),
+           _vectSize*sizeof(real_t));
+    memcpy(_covInvMatr+c*_stride, d.getCovInvVect().getArray(),
+           _vectSize*sizeof(real_t));
+    weight_t w = m.weight(c);
+    _weightVect[c] = w;
+    _cstVect[c] = d.getCst();
+    _logWeightVect[c] = log(w > EPS_LK ? w : EPS_LK);
+    _logCstVect[c] = log(d.getCst());
+    _logWeightCstVect[c] = _logWeightVect[c] + _logCstVect[c];
+
+    const real_t* m = _meanMatr+c*_stride;
+    const real_t* ci = _covInvMatr+c*_stride;
+    real_t* g = _gemmMatr+2*c*_stride;
+    real_t s = 0.0;
+    for (unsigned long i=0; i<_vectSize; i++)
+    {
+      g[i] = -0.5*ci[i];
+      g[_stride+i] = m[i]*ci[i];
+      s += m[i]*m[i]*ci[i];
+    }
+    _gemmCstVect[c] = _logWeightCstVect[c] - 0.5*s;
+
+    float* fm = _floatMeanMatr+c*_floatStride;
+    float* fci = _floatCovInvMatr+c*_floatStride;
+    for (unsigned long i=0; i<_vectSize; i++)
+    {
+      fm[i] = (float)m[i];
+      fci[i] = (float)ci[i];
+    }
+  }
+}
+//-------------------------------------------------------------------------
+bool P::matchesMixture() const // private
+{
+  const MixtureGD& m = *_pMixture;
+  if (m.getDistribCount() != _distribCount || m.getVectSize() != _vectSize)
+    return false;
+  for (unsigned long c=0; c<_distribCount; c++)
+  {
+    const DistribGD& d = m.getDistrib(c);
+    if (m.weight(c) != _weightVect[c] || d.getCst() != _cstVect[c] ||
+        memcmp(_meanMatr+c*_stride, d.getMeanVect().getArray(),
+               _vectSize*sizeof(real_t)) != 0 ||
+        memcmp(_covInvMatr+c*_stride, d.getCovInvVect().getArray(),
+               _vectSize*sizeof(real_t)) != 0)
+      return false;
+  }
+  return true;
+}
+//-------------------------------------------------------------------------
+bool P::isUpToDate() const
+{
+  // _stamp is shared by the threads scoring with this object
+  const unsigned long lastStamp = Distrib::getLastStamp();
+  const unsigned long stamp = atomicLoad(_stamp);
+  if (lastStamp == stamp)
+    return true;
+  const MixtureGD& m = *_pMixture;
+  bool modified = (m.getStamp() > stamp ||
+                   m.getDistribCount() != _distribCount);
+  for (unsigned long c=0; !modified && c<_distribCount; c++)
+    modified = (m.getDistrib(c).getStamp() > stamp);
+  if (modified && !matchesMixture())
+    return false;
+  atomicStore(_stamp, lastStamp); // nothing has changed since the check
+  return true;
+}
+//-------------------------------------------------------------------------
+bool P::update()
+{
+  if (isUpToDate())
+    return false;
+  build();
+  return true;
+}
+//-------------------------------------------------------------------------
+const MixtureGD& P::getMixture() const { return *_pMixture; }
+//-------------------------------------------------------------------------
+unsigned long P::getDistribCount() const { return _distribCount; }
+//-------------------------------------------------------------------------
+unsigned long P::getVectSize() const { return _vectSize; }
+//-------------------------------------------------------------------------
+unsigned long P::getStride() const { return _stride; }
+//-------------------------------------------------------------------------
+const real_t* P::getMeanMatrix() const { return _meanMatr; }
+//-------------------------------------------------------------------------
+const real_t* P::getCovInvMatrix() const { return _covInvMatr; }
+//-------------------------------------------------------------------------
+const weight_t* P::getWeightVect() const { return _weightVect.getArray(); }
+//-------------------------------------------------------------------------
+const real_t* P::getCstVect() const { return _cstVect.getArray(); }
+//-------------------------------------------------------------------------
+const real_t* P::getLogWeightVect() const
+{ return _logWeightVect.getArray(); }
+//-------------------------------------------------------------------------
+const real_t* P::getLogCstVect() const { return _logCstVect.getArray(); }
+//-------------------------------------------------------------------------
+const real_t* P::getLogWeightCstVect() const
+{ return _logWeightCstVect.getArray(); }
+//-------------------------------------------------------------------------
+const real_t* P::getGemmMatrix() const { return _gemmMatr; }
+//-------------------------------------------------------------------------
+const real_t* P::getGemmCstVect() const { return _gemmCstVect.getArray(); }
+//-------------------------------------------------------------------------
+unsigned long P::getFloatStride() const { return _floatStride; }
+//-------------------------------------------------------------------------
+const float* P::getFloatMeanMatrix() const { return _floatMeanMatr; }
+//-------------------------------------------------------------------------
+const float* P::getFloatCovInvMatrix() const { return _floatCovInvMatr; }
+//-------------------------------------------------------------------------
+String P::getClassName() const { return "MixtureGDPacked"; }
+//-------------------------------------------------------------------------
+String P::toString() const
+{
+  return Object::toString()
+    + "\n  mixture      = '" + _pMixture->getId() + "'"
+    + "\n  distribCount = " + String::valueOf(_distribCount)
+    + "\n  vectSize     = " + String::valueOf(_vectSize)
+    + "\n  stride       = " + String::valueOf(_stride);
+}
+//-------------------------------------------------------------------------
+P::~MixtureGDPacked()
+{
+  delete [] _pBuffer;
+  delete [] _pFloatBuffer;
+}
+//-------------------------------------------------------------------------
+
+#endif // !defined(ALIZE_MixtureGDPacked_cpp)
@@ -0,0 +1,212 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+
+#if !defined(ALIZE_MixtureGDPackedSet_cpp)
+#define ALIZE_MixtureGDPackedSet_cpp
+
+#include <new>
+#include <cstddef>
+#include <memory.h>
+#include "MixtureGDPackedSet.h"
+#include "MixtureGD.h"
+#include "DistribGD.h"
+#include "alizeString.h"
+#include "Exception.h"
+
+using namespace alize;
+typedef MixtureGDPackedSet P;
+
+//-------------------------------------------------------------------------
+P::MixtureGDPackedSet()
+:Object(), _distribCount(0), _vectSize(0), _stride(0), _capacity(0),
+ _stamp(0), _pBuffer(NULL), _paramMatr(NULL) {}
+//-------------------------------------------------------------------------
+unsigned long P::addMixture(const MixtureGD& m)
+{
+  const unsigned long n = _mixtureVect.size();
+  if (n == 0)
+  {
+    _distribCount = m.getDistribCount();
+    _vectSize = m.getVectSize();
+    _stride = (_vectSize+7) & ~7UL; // 8 doubles = 64 bytes
+  }
+  else if (m.getDistribCount() != _distribCount ||
+           m.getVectSize() != _vectSize)
+    throw Exception("mixture '" + m.getId() + "' (distribCount = "
+        + String::valueOf(m.getDistribCount()) + ", vectSize = "
+        + String::valueOf(m.getVectSize()) + ") does not match the set ("
+        + String::valueOf(_distribCount) + ", "
+        + String::valueOf(_vectSize) + ")", __FILE__, __LINE__);
+  const unsigned long rowSize = 2*_distribCount*_stride; // one mixture
+  if (n == 0 || n == _capacity)
+  {
+    const unsigned long capacity = (n == 0 && _capacity != 0) ? _capacity
+                                 : (_capacity == 0 ? 1 : 2*_capacity);
+    real_t* pBuffer = new (std::nothrow) real_t[capacity*rowSize+8];
+    assertMemoryIsAllocated(pBuffer, __FILE__, __LINE__);
+    real_t* p = pBuffer;
+    while (reinterpret_cast<size_t>(p) % 64 != 0)
+      p++;
+    memset(p, 0, capacity*rowSize*sizeof(real_t));
+    if (n != 0)
+      memcpy(p, _paramMatr, n*rowSize*sizeof(real_t));
+    delete [] _pBuffer;
+    _pBuffer = pBuffer;
+    _paramMatr = p;
+    _capacity = capacity;
+  }
+  _weightVect.setSize((n+1)*_distribCount);
+  _cstVect.setSize((n+1)*_distribCount);
+  _stampVect.setSize(n+1);
+  _mixtureVect.addObject(m);
+  pack(n);
+  return n;
+}
+//-------------------------------------------------------------------------
+void P::pack(unsigned long i) // private
+{
+  const MixtureGD& m = _mixtureVect.getObject(i);
+  if (m.getDistribCount() != _distribCount || m.getVectSize() != _vectSize)
+    throw Exception("mixture '" + m.getId() + "' has been resized",
+                    __FILE__, __LINE__);
+  _stampVect[i] = Distrib::getLastStamp();
+  real_t* row = _paramMatr + 2*i*_distribCount*_stride;
+  for (unsigned long c=0; c<_distribCount; c++, row+=2*_stride)
+  {
+    const DistribGD& d = m.getDistrib(c);
+    memcpy(row, d.getMeanVect().getArray(), _vectSize*sizeof(real_t));
+    memcpy(row+_stride, d.getCovInvVect().getArray(),
+           _vectSize*sizeof(real_t));
+    _weightVect[i*_distribCount+c] = m.weight(c);
+    _cstVect[i*_distribCount+c] = d.getCst();
+  }
+}
+//-------------------------------------------------------------------------
+void P::clear()
+{
+  _mixtureVect.clear();
+  _weightVect.clear();
+  _cstVect.clear();
+  _stampVect.clear();
+}
+//-------------------------------------------------------------------------
+bool P::isModified(unsigned long i) const // private
+{
+  const MixtureGD& m = _mixtureVect.getObject(i);
+  const unsigned long stamp = _stampVect[i];
+  if (m.getStamp() > stamp || m.getDistribCount() != _distribCount)
+    return true;
+  for (unsigned long c=0; c<_distribCount; c++)
+    if (m.getDistrib(c).getStamp() > stamp)
+      return true;
+  return false;
+}
+//-------------------------------------------------------------------------
+bool P::isUpToDate() const
+{
+  // _stamp is shared by the threads scoring with this object
+  const unsigned long lastStamp = Distrib::getLastStamp();
+  if (lastStamp == atomicLoad(_stamp))
+    return true;
+  for (unsigned long i=0; i<_mixtureVect.size(); i++)
+    if (isModified(i))
+      return false;
+  atomicStore(_stamp, lastStamp); // nothing has changed since the check
+  return true;
+}
+//-------------------------------------------------------------------------
+bool P::update()
+{
+  if (isUpToDate())
+    return false;
+  for (unsigned long i=0; i<_mixtureVect.size(); i++)
+    if (isModified(i))
+      pack(i);
+  _stamp = Distrib::getLastStamp();
+  return true;
+}
+//-------------------------------------------------------------------------
+unsigned long P::getMixtureCount() const { return _mixtureVect.size(); }
+//-------------------------------------------------------------------------
+const MixtureGD& P::getMixture(unsigned long i) const
+{ return _mixtureVect.getObject(i); }
+//-------------------------------------------------------------------------
+unsigned long P::getDistribCount() const { return _distribCount; }
+//-------------------------------------------------------------------------
+unsigned long P::getVectSize() const { return _vectSize; }
+//-------------------------------------------------------------------------
+unsigned long P::getStride() const { return _stride; }
+//-------------------------------------------------------------------------
+const real_t* P::getParamMatrix() const { return _paramMatr; }
+//-------------------------------------------------------------------------
+const weight_t* P::getWeightVect() const { return _weightVect.getArray(); }
+//-------------------------------------------------------------------------
+const real_t* P::getCstVect() const { return _cstVect.getArray(); }
+//-------------------------------------------------------------------------
+String P::getClassName() const { return "MixtureGDPackedSet"; }
+//-------------------------------------------------------------------------
+String P::toString() const
+{
+  return Object::toString()
+    + "\n  mixtureCount = " + String::valueOf(_mixtureVect.size())
+    + "\n  distribCount = " + String::valueOf(_distribCount)
+    + "\n  vectSize     = " + String::valueOf(_vectSize)
+    + "\n  stride       = " + String::valueOf(_stride);
+}
+//-------------------------------------------------------------------------
+P::~MixtureGDPackedSet() { delete [] _pBuffer; }
+//-------------------------------------------------------------------------
+
+#endif // !defined(ALIZE_MixtureGDPackedSet_cpp)
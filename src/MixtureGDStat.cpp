@@ -118,9 +118,11 @@ occ_t M::computeAndAccumulateEM(const Feature& f, double w)
 
   for (unsigned long c=0; c<_distribCount; c++)
   {
+    // the accumulators do not need a new stamp for each feature : it is
+    // renewed when they are read (getEM(), getInternalAccumEM())
     DistribGD& d = _pMixForAccumulation->getDistrib(c);
-    meanVect = d.getMeanVect().getArray();
-    covVect  = d.getCovVect().getArray();
+    meanVect = d.getMeanArrayForAccumulation();
+    covVect  = d.getCovArrayForAccumulation();
     
     for (unsigned long i=0; i<vectSize; i++)
     {
@@ -199,6 +201,8 @@ MixtureGD& M::getInternalAccumEM()
 {
   assertResetEMDone();
   assert(_pMixForAccumulation != NULL);
+  for (unsigned long c=0; c<_distribCount; c++)
+    _pMixForAccumulation->getDistrib(c).updateStamp();
   return *_pMixForAccumulation;
 }
 //-------------------------------------------------------------------------
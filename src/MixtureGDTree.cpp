@@ -0,0 +1,440 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+
+#if !defined(ALIZE_MixtureGDTree_cpp)
+#define ALIZE_MixtureGDTree_cpp
+
+#include <cmath>
+#include <memory.h>
+#include "MixtureGDTree.h"
+#include "MixtureGD.h"
+#include "DistribGD.h"
+#include "Feature.h"
+#include "FeatureBlock.h"
+#include "LKVector.h"
+#include "SimdKernels.h"
+#include "alizeString.h"
+#include "Exception.h"
+
+using namespace alize;
+typedef MixtureGDTree T;
+
+//-------------------------------------------------------------------------
+T::MixtureGDTree(const MixtureGD& m, unsigned long clusterCount,
+                 unsigned long iterationCount)
+:Object(), _pMixture(&m), _clusterCount(clusterCount),
+ _iterationCount(iterationCount), _distribCount(0), _vectSize(0), _stamp(0)
+{
+  if (clusterCount == 0)
+    throw Exception("clusterCount cannot be 0", __FILE__, __LINE__);
+  build();
+}
+//-------------------------------------------------------------------------
+// Assigns each distribution to the nearest center. Returns the number of
+// distributions that have changed of cluster.
+unsigned long T::assign(const real_t* meanMatr, const real_t* centerMatr,
+                        unsigned long k, const real_t* scaleVect,
+                        ULongVector& clusterVect,
+                        DoubleVector& distVect) const // private
+{
+  const unsigned long n = _vectSize;
+  unsigned long changeCount = 0;
+  for (unsigned long c=0; c<_distribCount; c++)
+  {
+    const real_t* mean = meanMatr+c*n;
+    unsigned long best = 0;
+    real_t bestDist = 0.0;
+    for (unsigned long j=0; j<k; j++)
+    {
+      real_t dist = SimdKernels::diagQuadForm(mean, centerMatr+j*n,
+                                              scaleVect, n);
+      if (j == 0 || dist < bestDist)
+      {
+        bestDist = dist;
+        best = j;
+      }
+    }
+    if (clusterVect[c] != best)
+    {
+      clusterVect[c] = best;
+      changeCount++;
+    }
+    distVect[c] = bestDist;
+  }
+  return changeCount;
+}
+//-------------------------------------------------------------------------
+void T::build() // private
+{
+  const MixtureGD& m = *_pMixture;
+  _stamp = Distrib::getLastStamp();
+  _mixtureId = m.getId();
+  _distribCount = m.getDistribCount();
+  _vectSize = m.getVectSize();
+  const unsigned long n = _vectSize;
+  const unsigned long k = _clusterCount < _distribCount ?
+                          _clusterCount : _distribCount;
+  unsigned long c, i, j;
+
+  // copy of the parameters, one row per distribution
+  DoubleVector meanVect(_distribCount*n, _distribCount*n);
+  DoubleVector covInvVect(_distribCount*n, _distribCount*n);
+  real_t* meanMatr = meanVect.getArray();
+  real_t* covInvMatr = covInvVect.getArray();
+  for (c=0; c<_distribCount; c++)
+  {
+    const DistribGD& d = m.getDistrib(c);
+    memcpy(meanMatr+c*n, d.getMeanVect().getArray(), n*sizeof(real_t));
+    memcpy(covInvMatr+c*n, d.getCovInvVect().getArray(),
+           n*sizeof(real_t));
+  }
+
+  // the distance between two means is weighted by the average inverse
+  // covariance of the distributions
+  DoubleVector scaleVect(n, n);
+  scaleVect.setAllValues(0.0);
+  for (c=0; c<_distribCount; c++)
+    for (i=0; i<n; i++)
+      scaleVect[i] += covInvMatr[c*n+i];
+  for (i=0; i<n && _distribCount != 0; i++)
+    scaleVect[i] /= _distribCount;
+
+  // k-means on the means. The initial centers are chosen by a farthest
+  // point traversal from the first distribution, so the index is the same
+  // from one run to another.
+  DoubleVector centerVect(k*n, k*n);
+  real_t* center = centerVect.getArray();
+  DoubleVector distVect(_distribCount, _distribCount);
+  unsigned long farthest = 0;
+  for (j=0; j<k; j++)
+  {
+    memcpy(center+j*n, meanMatr+farthest*n, n*sizeof(real_t));
+    farthest = 0;
+    for (c=0; c<_distribCount; c++)
+    {
+      real_t dist = SimdKernels::diagQuadForm(meanMatr+c*n, center+j*n,
+                                              scaleVect.getArray(), n);
+      if (j == 0 || dist < distVect[c])
+        distVect[c] = dist;
+      if (distVect[c] > distVect[farthest])
+        farthest = c;
+    }
+  }
+  ULongVector clusterVect(_distribCount, _distribCount);
+  clusterVect.setAllValues(k);
+  ULongVector countVect(k, k);
+
+  for (unsigned long it=0; ; it++)
+  {
+    unsigned long changeCount = assign(meanMatr, center, k,
+                           scaleVect.getArray(), clusterVect, distVect);
+    countVect.setAllValues(0);
+    for (c=0; c<_distribCount; c++)
+      countVect[clusterVect[c]]++;
+    // an empty cluster takes the distribution that is the farthest from
+    // its center, if it is not alone in its cluster
+    for (j=0; j<k; j++)
+    {
+      if (countVect[j] != 0)
+        continue;
+      unsigned long worst = _distribCount;
+      for (c=0; c<_distribCount; c++)
+        if (countVect[clusterVect[c]] > 1 &&
+            (worst == _distribCount || distVect[c] > distVect[worst]))
+          worst = c;
+      countVect[clusterVect[worst]]--;
+      countVect[j] = 1;
+      clusterVect[worst] = j;
+      distVect[worst] = 0.0;
+      memcpy(center+j*n, meanMatr+worst*n, n*sizeof(real_t));
+      changeCount++;
+    }
+    if (changeCount == 0 || it+1 >= _iterationCount)
+      break;
+    centerVect.setAllValues(0.0);
+    for (c=0; c<_distribCount; c++)
+    {
+      const real_t* mean = meanMatr+c*n;
+      real_t* p = center+clusterVect[c]*n;
+      for (i=0; i<n; i++)
+        p[i] += mean[i];
+    }
+    for (j=0; j<k; j++)
+      for (i=0; i<n; i++)
+        center[j*n+i] /= countVect[j];
+  }
+
+  // distributions grouped by cluster
+  _firstMemberVect.setSize(k+1);
+  _firstMemberVect[0] = 0;
+  for (j=0; j<k; j++)
+    _firstMemberVect[j+1] = _firstMemberVect[j] + countVect[j];
+  _memberVect.setSize(_distribCount);
+  countVect.setAllValues(0);
+  for (c=0; c<_distribCount; c++)
+  {
+    j = clusterVect[c];
+    _memberVect[_firstMemberVect[j] + countVect[j]++] = c;
+  }
+
+  // parent gaussians : mean and variance of the union of the members
+  // (all the members have the same weight)
+  _parentMeanVect.setSize(k*n);
+  _parentCovInvVect.setSize(k*n);
+  _parentLogCstVect.setSize(k);
+  _parentMeanVect.setAllValues(0.0);
+  _parentCovInvVect.setAllValues(0.0);
+  real_t* parentMean = _parentMeanVect.getArray();
+  real_t* parentVar = _parentCovInvVect.getArray();
+  for (j=0; j<k; j++)
+  {
+    const unsigned long* member = getMemberArray(j);
+    const unsigned long memberCount = getMemberCount(j);
+    real_t* pm = parentMean+j*n;
+    real_t* pv = parentVar+j*n;
+    unsigned long l;
+    for (l=0; l<memberCount; l++)
+    {
+      const real_t* mean = meanMatr+member[l]*n;
+      for (i=0; i<n; i++)
+        pm[i] += mean[i];
+    }
+    for (i=0; i<n; i++)
+      pm[i] /= memberCount;
+    for (l=0; l<memberCount; l++)
+    {
+      const real_t* mean = meanMatr+member[l]*n;
+      const real_t* covInv = covInvMatr+member[l]*n;
+      for (i=0; i<n; i++)
+        pv[i] += 1.0/covInv[i] + (mean[i]-pm[i])*(mean[i]-pm[i]);
+    }
+    real_t logDet = 0.0;
+    for (i=0; i<n; i++)
+    {
+      pv[i] /= memberCount;
+      logDet += log(pv[i]);
+      pv[i] = 1.0/pv[i];
+    }
+    _parentLogCstVect[j] = -0.5*(logDet + n*log(PI2));
+  }
+}
+//-------------------------------------------------------------------------
+bool T::isUpToDate() const
+{
+  // _stamp may be shared by several threads using this object
+  const unsigned long lastStamp = Distrib::getLastStamp();
+  const unsigned long stamp = atomicLoad(_stamp);
+  if (lastStamp == stamp)
+    return true;
+  const MixtureGD& m = *_pMixture;
+  if (m.getStamp() > stamp || m.getDistribCount() != _distribCount)
+    return false;
+  for (unsigned long c=0; c<_distribCount; c++)
+    if (m.getDistrib(c).getStamp() > stamp)
+      return false;
+  atomicStore(_stamp, lastStamp); // nothing has changed since the check
+  return true;
+}
+//-------------------------------------------------------------------------
+bool T::update()
+{
+  if (isUpToDate())
+    return false;
+  build();
+  return true;
+}
+//-------------------------------------------------------------------------
+const MixtureGD& T::getMixture() const { return *_pMixture; }
+//-------------------------------------------------------------------------
+const String& T::getMixtureId() const { return _mixtureId; }
+//-------------------------------------------------------------------------
+unsigned long T::getDistribCount() const { return _distribCount; }
+//-------------------------------------------------------------------------
+unsigned long T::getClusterCount() const
+{ return _firstMemberVect.size()-1; }
+//-------------------------------------------------------------------------
+unsigned long T::getMemberCount(unsigned long k) const
+{
+  assertIsInBounds(__FILE__, __LINE__, k, getClusterCount());
+  return _firstMemberVect[k+1] - _firstMemberVect[k];
+}
+//-------------------------------------------------------------------------
+const unsigned long* T::getMemberArray(unsigned long k) const
+{
+  assertIsInBounds(__FILE__, __LINE__, k, getClusterCount());
+  return _memberVect.getArray() + _firstMemberVect[k];
+}
+//-------------------------------------------------------------------------
+void T::selectClusters(const Feature& f, unsigned long beam,
+                       LKVector& clusterLkVect) const
+{
+  const unsigned long k = getClusterCount();
+  const unsigned long n = _vectSize;
+  const real_t* x = f.getDataVector();
+  const real_t* mean = _parentMeanVect.getArray();
+  const real_t* covInv = _parentCovInvVect.getArray();
+  clusterLkVect.setSize(k);
+  LKVector::type* v = clusterLkVect.getArray();
+  for (unsigned long j=0; j<k; j++)
+  {
+    v[j].idx = j;
+    v[j].lk = _parentLogCstVect[j]
+            - 0.5*SimdKernels::diagQuadForm(x, mean+j*n, covInv+j*n, n);
+  }
+  clusterLkVect.descendingPartialSort(beam);
+}
+//-------------------------------------------------------------------------
+unsigned long T::computeTopDistribs(const Feature& f, unsigned long beam,
+                                    unsigned long nTop, LKVector& lkVect,
+                                    LKVector& clusterLkVect) const
+{
+  const unsigned long k = getClusterCount();
+  if (beam > k)
+    beam = k;
+  selectClusters(f, beam, clusterLkVect);
+  const LKVector::type* cv = clusterLkVect.getArray();
+  const weight_t* w = _pMixture->getTabWeight().getArray();
+  Distrib** d = _pMixture->getTabDistrib();
+  lkVect.setSize(_distribCount);
+  LKVector::type* v = lkVect.getArray();
+  unsigned long i, j, c, computedCount = 0;
+
+  for (j=0; j<beam; j++)
+  {
+    const unsigned long* member = getMemberArray(cv[j].idx);
+    for (i=getMemberCount(cv[j].idx); i>0; i--, member++, computedCount++)
+    {
+      c = *member;
+      v[computedCount].idx = c;
+      v[computedCount].lk = w[c] * d[c]->computeLK(f);
+    }
+  }
+  for (c=computedCount; j<k; j++)
+  {
+    const unsigned long* member = getMemberArray(cv[j].idx);
+    for (i=getMemberCount(cv[j].idx); i>0; i--, member++, c++)
+    {
+      v[c].idx = *member;
+      v[c].lk = 0.0;
+    }
+  }
+  lkVect.setSize(computedCount);
+  lkVect.descendingPartialSort(nTop);
+  lkVect.setSize(_distribCount);
+  return computedCount;
+}
+//-------------------------------------------------------------------------
+void T::computeRecall(const FeatureBlock& b, unsigned long beam,
+                      unsigned long nTop, real_t& recall,
+                      real_t& computedRatio) const
+{
+  if (b.getVectSize() != _vectSize)
+    throw Exception("block vectSize ("
+        + String::valueOf(b.getVectSize()) + ") != mixture vectSize ("
+        + String::valueOf(_vectSize) + ")", __FILE__, __LINE__);
+  if (nTop > _distribCount)
+    nTop = _distribCount;
+  const unsigned long featureCount = b.getFeatureCount();
+  const weight_t* w = _pMixture->getTabWeight().getArray();
+  Distrib** d = _pMixture->getTabDistrib();
+  Feature f(_vectSize);
+  LKVector exactVect, treeVect, clusterVect;
+  real_t foundCount = 0.0, computedCount = 0.0;
+
+  for (unsigned long t=0; t<featureCount; t++)
+  {
+    b.getFeature(f, t);
+    exactVect.setSize(_distribCount);
+    LKVector::type* e = exactVect.getArray();
+    unsigned long c, i, j;
+    for (c=0; c<_distribCount; c++)
+    {
+      e[c].idx = c;
+      e[c].lk = w[c] * d[c]->computeLK(f);
+    }
+    exactVect.descendingPartialSort(nTop);
+    unsigned long computed = computeTopDistribs(f, beam, nTop, treeVect,
+                                                clusterVect);
+    computedCount += computed;
+    const LKVector::type* v = treeVect.getArray();
+    for (i=0; i<nTop && i<computed; i++)
+      for (j=0; j<nTop; j++)
+        if (v[i].idx == e[j].idx)
+        {
+          foundCount++;
+          break;
+        }
+  }
+  recall = (featureCount == 0 || nTop == 0) ? 1.0
+         : foundCount/(featureCount*nTop);
+  computedRatio = (featureCount == 0 || _distribCount == 0) ? 0.0
+         : computedCount/((real_t)featureCount*_distribCount);
+}
+//-------------------------------------------------------------------------
+String T::getClassName() const { return "MixtureGDTree"; }
+//-------------------------------------------------------------------------
+String T::toString() const
+{
+  return Object::toString()
+    + "\n  mixture      = '" + _pMixture->getId() + "'"
+    + "\n  distribCount = " + String::valueOf(_distribCount)
+    + "\n  vectSize     = " + String::valueOf(_vectSize)
+    + "\n  clusterCount = " + String::valueOf(getClusterCount());
+}
+//-------------------------------------------------------------------------
+T::~MixtureGDTree() {}
+//-------------------------------------------------------------------------
+
+#endif // !defined(ALIZE_MixtureGDTree_cpp)
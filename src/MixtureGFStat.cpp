@@ -102,6 +102,7 @@ void M::resetEM()
   for (unsigned long cc=0; cc<_distribCount; cc++)
   {
     DistribGF& d = _pMixForAccumulation->getDistrib(cc);
+    d.getCovMatrix().setSize(vectSize); // not allocated by default
 
     real_t* m = d.getMeanVect().getArray();	
     real_t* c = d.getCovMatrix().getArray();
@@ -153,10 +154,24 @@ void M::addAccEM(const MixtureStat& mx)
     throw Exception("MixtureStat incompatibility", __FILE__, __LINE__);
   if (p->_distribCount != _distribCount)
     throw Exception("MixtureStat incompatibility", __FILE__, __LINE__);
-  //const MixtureGFStat& m = static_cast<const MixtureGFStat&>(mx);
+  const MixtureGFStat& m = static_cast<const MixtureGFStat&>(mx);
 
-  throw Exception("unimplemented method :o(", __FILE__, __LINE__);
-  // TODO : implement this method
+  _accumulatedOccVect += m._accumulatedOccVect;
+  _featureCounterForAccumulatedOcc += m._featureCounterForAccumulatedOcc;
+
+  unsigned long vectSize2 = _pMixture->getVectSize()*_pMixture->getVectSize();
+  for (unsigned long c=0; c<_distribCount; c++)
+  {
+    DistribGF& d = _pMixForAccumulation->getDistrib(c);
+    const DistribGF& d2 = m._pMixForAccumulation->getDistrib(c);
+    d.getMeanVect() += d2.getMeanVect();
+    real_t* covMatr = d.getCovMatrix().getArray();
+    const real_t* covMatr2 = d2.getCovMatrix().getArray();
+    // the first value is a constant (see resetEM())
+    for (unsigned long i=1; i<vectSize2; i++)
+      covMatr[i] += covMatr2[i];
+  }
+  _featureCounterForEM += m._featureCounterForEM;
 }
 //-------------------------------------------------------------------------
 const Mixture& M::getEM()
@@ -184,6 +199,7 @@ const Mixture& M::getEM()
       dTmpMeanVect = dTmp.getMeanVect().getArray();
 
       DistribGF& d = _pMixtureForEM->getDistrib(c);
+      d.getCovMatrix().setSize(vectSize); // removed by computeAll()
       dCovMatr  = d.getCovMatrix().getArray();
       dMeanVect = d.getMeanVect().getArray();
 
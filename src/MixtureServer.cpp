@@ -57,6 +57,7 @@
 
 //#include <cstdlib>
 
+#include <new>
 #include <ctime>
 #include "MixtureServer.h"
 #include "MixtureFileReader.h"
@@ -69,10 +70,33 @@
 #include "Exception.h"
 #include "XLine.h"
 #include "ULongVector.h"
+#include "TaskPool.h"
 
 using namespace alize;
 typedef MixtureServer S;
 
+//-------------------------------------------------------------------------
+// reads the mixtures of a range of files of a list
+class MixtureServer::LoadTask : public TaskPool::Task
+{
+public :
+  LoadTask(const MixtureServer& ms, const XLine& l, Mixture** mixtureVect)
+  :_ms(ms), _l(l), _mixtureVect(mixtureVect) {}
+
+  virtual void run(unsigned long first, unsigned long last, unsigned long)
+  {
+    for (unsigned long i=first; i<last; i++)
+    {
+      try { _mixtureVect[i] = &_ms.readMixtureCopy(_l.getElement(i, false)); }
+      catch (Exception&) { _mixtureVect[i] = NULL; } // see loadMixture()
+    }
+  }
+private :
+  const MixtureServer& _ms;
+  const XLine&         _l;
+  Mixture**            _mixtureVect;
+};
+
 //-------------------------------------------------------------------------
 S::MixtureServer(const Config& c)
 :Object(), _config(c) { reset(); }
@@ -291,8 +315,7 @@ Mixture& S::loadMixture(const FileName& f)
   if (!_config.existsParam_vectSize)
     const_cast<Config&>(_config)
                    .setParam("vectSize", String::valueOf(m0.getVectSize()));
-  Mixture& m = createMixture(m0.getDistribCount(), m0.getType());
-  m = m0;
+  Mixture& m = addLoadedMixture(m0.duplicate(K::k, DUPL_DISTRIB));
   autoSetMixtureId(m, f);
   return m;
 }
@@ -311,12 +334,39 @@ Mixture& S::loadMixture(const FileName& f, DistribType type) // private
   if (!_config.existsParam_vectSize)
     const_cast<Config&>(_config)
                    .setParam("vectSize", String::valueOf(m0.getVectSize()));
-  Mixture& m = createMixture(m0.getDistribCount(), type);
-  m = m0; // operator= overloaded. // Does not copy Id.
+  Mixture& m = addLoadedMixture(m0.duplicate(K::k, DUPL_DISTRIB));
   autoSetMixtureId(m, f);
   return m;
 }
 //-------------------------------------------------------------------------
+Mixture& S::readMixtureCopy(const FileName& f) const // private
+{
+  // can be called by several threads at the same time
+  MixtureFileReader r(f, _config);
+  return r.readMixture().duplicate(K::k, DUPL_DISTRIB);
+}
+//-------------------------------------------------------------------------
+Mixture& S::addLoadedMixture(Mixture& m) // private
+{
+  // same result as createMixture() followed by operator= but the
+  // distributions of m are used instead of new randomly initialized ones.
+  // Deletes m if it cannot be added.
+  const unsigned long vectSize = m.getVectSize();
+  if (_vectSizeDefined && vectSize != _vectSize)
+  {
+    delete &m;
+    throw Exception("Incompatible vectSize", __FILE__, __LINE__);
+  }
+  m.setId(K::k, newId());
+  addMixtureToDict(m);
+  const unsigned long n = m.getDistribCount();
+  for (unsigned long c=0; c<n; c++)
+  { addDistribToDict(m.getDistrib(c)); }
+  _vectSize = vectSize;
+  _vectSizeDefined = true;
+  return m;
+}
+//-------------------------------------------------------------------------
 void S::autoSetMixtureId(Mixture& m, String id) // private
 {
   const String f = id;
@@ -328,9 +378,47 @@ void S::autoSetMixtureId(Mixture& m, String id) // private
 //-------------------------------------------------------------------------
 unsigned long S::loadMixture(const XLine& l)
 {
-  unsigned long first = getMixtureCount();
-  for (unsigned long i=0; i<l.getElementCount(); i++)
-    loadMixture(l.getElement(i));
+  TaskPool p(_config);
+  return loadMixture(l, p);
+}
+//-------------------------------------------------------------------------
+unsigned long S::loadMixture(const XLine& l, TaskPool& p)
+{
+  const unsigned long first = getMixtureCount();
+  const unsigned long n = l.getElementCount();
+  Mixture** mixtureVect = new (std::nothrow) Mixture*[n+1];
+  assertMemoryIsAllocated(mixtureVect, __FILE__, __LINE__);
+  LoadTask t(*this, l, mixtureVect);
+  p.parallelFor(0, n, 1, t); // one file at a time
+  unsigned long i = 0;
+  try
+  {
+    for (; i<n; i++)
+    {
+      const FileName& f = l.getElement(i, false);
+      Mixture* pMixture = mixtureVect[i];
+      mixtureVect[i] = NULL;
+      if (pMixture == NULL) // reads the file again to throw the exception
+        loadMixture(f);
+      else
+      {
+        if (!_config.existsParam_vectSize)
+          const_cast<Config&>(_config).setParam("vectSize",
+                           String::valueOf(pMixture->getVectSize()));
+        autoSetMixtureId(addLoadedMixture(*pMixture), f);
+      }
+    }
+  }
+  catch (Exception&)
+  {
+    for (; i<n; i++)
+      delete mixtureVect[i];
+    delete [] mixtureVect;
+    throw;
+  }
+  delete [] mixtureVect;
+  if (n != 0)
+    l.getElement(n-1); // the last element becomes the current one
   return first;
 }
 //-------------------------------------------------------------------------
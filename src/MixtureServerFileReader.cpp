@@ -59,6 +59,7 @@
 #include "MixtureServerFileReader.h"
 #include "MixtureServerFileReaderRaw.h"
 #include "MixtureServerFileReaderXml.h"
+#include "MixtureServerFileReaderBinary.h"
 #include "MixtureServer.h"
 #include "Exception.h"
 #include "Config.h"
@@ -76,6 +77,9 @@ MixtureServerFileReaderAbstract& R::createReader(const FileName& f,
 {
   if ((f + getExt(f, c)).endsWith(".xml"))
     return MixtureServerFileReaderXml::create(f, c);
+  else if (MixtureServerFileReaderBinary::isBinaryFile(
+                                     getPath(f, c) + f + getExt(f, c)))
+    return MixtureServerFileReaderBinary::create(f, c);
   else
     return MixtureServerFileReaderRaw::create(f, c);
 }
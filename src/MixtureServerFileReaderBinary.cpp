@@ -0,0 +1,366 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+
+#if !defined(ALIZE_MixtureServerFileReaderBinary_cpp)
+#define ALIZE_MixtureServerFileReaderBinary_cpp
+
+#include <new>
+#include <cstdio>
+#include <memory.h>
+#include <stdint.h>
+#include "MixtureServerFileReaderBinary.h"
+#include "MixtureServer.h"
+#include "MixtureGD.h"
+#include "DistribGD.h"
+#include "Exception.h"
+#include "Config.h"
+#include "FileReader.h"
+
+using namespace alize;
+typedef MixtureServerFileReaderBinary R;
+
+static const unsigned long HEADER_LENGTH = 128;
+static const uint32_t BYTE_ORDER_MARK = 0x01020304;
+static const uint32_t EMPTY_SLOT = 0xFFFFFFFF;
+
+//-------------------------------------------------------------------------
+R::MixtureServerFileReaderBinary(const FileName& f, const Config& c)
+:MixtureServerFileReaderAbstract(&FileReader::create(f, getPath(f, c),
+ getExt(f, c), false)), _pData(NULL), _pOwnedData(NULL), _vectSize(0),
+ _stride(0), _distribCount(0), _mixtureCount(0), _componentCount(0),
+ _hashTableSize(0), _serverNameLength(0), _meanMatr(NULL),
+ _covInvMatr(NULL), _detCstVect(NULL), _pMixtureRecords(NULL),
+ _pDictIdxVect(NULL), _weightVect(NULL), _pHashTable(NULL),
+ _pStringPool(NULL), _stringPoolLength(0), _pLoadedServer(NULL),
+ _loadedDistribs(NULL), _loadedDictIdx(NULL) {}
+//-------------------------------------------------------------------------
+R& R::create(const FileName& f, const Config& c)
+{
+  R* p = new (std::nothrow) R(f, c);
+  assertMemoryIsAllocated(p, __FILE__, __LINE__);
+  return *p;
+}
+//-------------------------------------------------------------------------
+bool R::isBinaryFile(const FileName& fullFileName)
+{
+  FILE* pFile = ::fopen(fullFileName.c_str(), "rb");
+  if (pFile == NULL)
+    return false;
+  char magic[8];
+  bool ok = (::fread(magic, 1, 8, pFile) == 8 &&
+             memcmp(magic, "ALIZEMSB", 8) == 0);
+  ::fclose(pFile);
+  return ok;
+}
+//-------------------------------------------------------------------------
+unsigned long R::hashId(const String& id)
+{
+  const unsigned char* p =
+          reinterpret_cast<const unsigned char*>(id.c_str());
+  uint32_t h = 2166136261U;
+  for (unsigned long i=0; i<id.length(); i++)
+  {
+    h ^= p[i];
+    h *= 16777619U;
+  }
+  return h;
+}
+//-------------------------------------------------------------------------
+unsigned long R::getUInt4(const unsigned char* p, unsigned long i) const
+{ // private
+  uint32_t v;
+  memcpy(&v, p+4*i, 4);
+  return v;
+}
+//-------------------------------------------------------------------------
+void R::open(bool sequential) // private
+{
+  assert(_pReader != NULL);
+  if (_pData != NULL)
+  {
+    _pReader->adviseMapping(sequential);
+    return;
+  }
+  unsigned long length;
+  const char* pData = _pReader->map(sequential);
+  if (pData != NULL)
+    length = _pReader->getFileLength();
+  else // no mmap : loads the whole file
+  {
+    const FileName& name = _pReader->getFullFileName();
+    FILE* pFile = ::fopen(name.c_str(), "rb");
+    if (pFile == NULL)
+      throw FileNotFoundException("", __FILE__, __LINE__, name);
+    long l = -1;
+    if (::fseek(pFile, 0, SEEK_END) == 0)
+      l = ::ftell(pFile);
+    if (l < 0 || ::fseek(pFile, 0, SEEK_SET) != 0)
+    {
+      ::fclose(pFile);
+      throw IOException("Cannot read file", __FILE__, __LINE__, name);
+    }
+    length = l;
+    delete [] reinterpret_cast<double*>(_pOwnedData);
+    // array of doubles : aligned for the parameters
+    double* pBuffer = new (std::nothrow) double[length/sizeof(double)+1];
+    assertMemoryIsAllocated(pBuffer, __FILE__, __LINE__);
+    _pOwnedData = reinterpret_cast<char*>(pBuffer);
+    bool ok = (::fread(_pOwnedData, 1, length, pFile) == length);
+    ::fclose(pFile);
+    if (!ok)
+    {
+      delete [] pBuffer;
+      _pOwnedData = NULL;
+      throw IOException("Cannot read file", __FILE__, __LINE__, name);
+    }
+    pData = _pOwnedData;
+  }
+  // header
+  const unsigned char* h = reinterpret_cast<const unsigned char*>(pData);
+  if (length < HEADER_LENGTH || memcmp(h, "ALIZEMSB", 8) != 0)
+    error("does not contain binary mixture server data");
+  if (getUInt4(h, 2) != 1)
+    error("unsupported version " + String::valueOf(getUInt4(h, 2)));
+  if (getUInt4(h, 3) != BYTE_ORDER_MARK)
+    error("written with another byte order");
+  _vectSize = getUInt4(h, 4);
+  _stride = getUInt4(h, 5);
+  _distribCount = getUInt4(h, 6);
+  _mixtureCount = getUInt4(h, 7);
+  _componentCount = getUInt4(h, 8);
+  _hashTableSize = getUInt4(h, 9);
+  _serverNameLength = getUInt4(h, 10);
+  _stringPoolLength = getUInt4(h, 11);
+  if (_stride < _vectSize || _stride % 8 != 0)
+    error("invalid stride");
+  if (_hashTableSize <= _mixtureCount ||
+      (_hashTableSize & (_hashTableSize-1)) != 0)
+    error("invalid id index size");
+  if (_serverNameLength > _stringPoolLength)
+    error("invalid server name");
+  // arrays : offset and length
+  const uint64_t sizes[8] = {
+    (uint64_t)_distribCount*_stride*sizeof(double),
+    (uint64_t)_distribCount*_stride*sizeof(double),
+    (uint64_t)_distribCount*2*sizeof(double),
+    (uint64_t)_mixtureCount*4*4,
+    (uint64_t)_componentCount*4,
+    (uint64_t)_componentCount*sizeof(double),
+    (uint64_t)_hashTableSize*4,
+    (uint64_t)_stringPoolLength };
+  const char* p[8];
+  for (unsigned long i=0; i<8; i++)
+  {
+    uint64_t offset;
+    memcpy(&offset, h+48+8*i, 8);
+    if (offset % 8 != 0 || offset < HEADER_LENGTH || offset > length
+        || sizes[i] > length - offset)
+      error("truncated or invalid file");
+    p[i] = pData + offset;
+  }
+  _meanMatr = reinterpret_cast<const double*>(p[0]);
+  _covInvMatr = reinterpret_cast<const double*>(p[1]);
+  _detCstVect = reinterpret_cast<const double*>(p[2]);
+  _pMixtureRecords = reinterpret_cast<const unsigned char*>(p[3]);
+  _pDictIdxVect = reinterpret_cast<const unsigned char*>(p[4]);
+  _weightVect = reinterpret_cast<const double*>(p[5]);
+  _pHashTable = reinterpret_cast<const unsigned char*>(p[6]);
+  _pStringPool = p[7];
+  _pData = pData; // valid file
+}
+//-------------------------------------------------------------------------
+void R::readMixtureServer(MixtureServer& ms)
+{
+  open(true);
+  ms.reset();
+  char* name = new (std::nothrow) char[_serverNameLength+1];
+  assertMemoryIsAllocated(name, __FILE__, __LINE__);
+  memcpy(name, _pStringPool, _serverNameLength);
+  name[_serverNameLength] = 0;
+  ms.setServerName(name);
+  delete [] name;
+  for (unsigned long i=0; i<_distribCount; i++)
+    loadDistrib(ms, i);
+  for (unsigned long i=0; i<_mixtureCount; i++)
+    loadMixture(ms, i, false);
+}
+//-------------------------------------------------------------------------
+unsigned long R::getMixtureCount()
+{
+  open(false);
+  return _mixtureCount;
+}
+//-------------------------------------------------------------------------
+long R::getMixtureIndex(const String& id)
+{
+  open(false);
+  const unsigned long mask = _hashTableSize-1;
+  unsigned long s = hashId(id)&mask;
+  for (unsigned long n=0; n<_hashTableSize; n++, s=(s+1)&mask)
+  {
+    const unsigned long i = getUInt4(_pHashTable, s);
+    if (i == EMPTY_SLOT)
+      return -1;
+    if (i >= _mixtureCount)
+      error("invalid id index");
+    const unsigned long offset = getUInt4(_pMixtureRecords, 4*i+2);
+    const unsigned long length = getUInt4(_pMixtureRecords, 4*i+3);
+    if (offset > _stringPoolLength || length > _stringPoolLength-offset)
+      error("invalid mixture id");
+    if (length == id.length() &&
+        memcmp(_pStringPool+offset, id.c_str(), length) == 0)
+      return i;
+  }
+  error("invalid id index"); // full table : the file is corrupt
+  return -1;
+}
+//-------------------------------------------------------------------------
+MixtureGD& R::readMixture(MixtureServer& ms, const String& id)
+{
+  long i = getMixtureIndex(id);
+  if (i == -1)
+    throw Exception("Mixture '" + id + "' not found in file '"
+        + _pReader->getFullFileName() + "'", __FILE__, __LINE__);
+  return loadMixture(ms, i, true);
+}
+//-------------------------------------------------------------------------
+DistribGD& R::loadDistrib(MixtureServer& ms, unsigned long idx) // private
+{
+  DistribGD& d = static_cast<DistribGD&>
+                (ms.createDistrib(DistribType_GD, _vectSize));
+  memcpy(d.getMeanVect().getArray(), _meanMatr+idx*_stride,
+         _vectSize*sizeof(double));
+  memcpy(d.getCovInvVect().getArray(), _covInvMatr+idx*_stride,
+         _vectSize*sizeof(double));
+  d.setDet(K::k, _detCstVect[2*idx]);
+  d.setCst(K::k, _detCstVect[2*idx+1]);
+  return d;
+}
+//-------------------------------------------------------------------------
+MixtureGD& R::loadMixture(MixtureServer& ms, unsigned long idx,
+                          bool shareDistribs) // private
+{
+  const unsigned long first = getUInt4(_pMixtureRecords, 4*idx);
+  const unsigned long count = getUInt4(_pMixtureRecords, 4*idx+1);
+  const unsigned long offset = getUInt4(_pMixtureRecords, 4*idx+2);
+  const unsigned long length = getUInt4(_pMixtureRecords, 4*idx+3);
+  if (first > _componentCount || count > _componentCount-first)
+    error("invalid mixture components");
+  if (offset > _stringPoolLength || length > _stringPoolLength-offset)
+    error("invalid mixture id");
+  for (unsigned long c=0; c<count; c++)
+    if (getUInt4(_pDictIdxVect, first+c) >= _distribCount)
+      error("invalid distribution index");
+
+  if (shareDistribs && _pLoadedServer != &ms)
+  {
+    if (_loadedDistribs == NULL)
+    {
+      _loadedDistribs = new (std::nothrow) DistribGD*[_distribCount+1];
+      assertMemoryIsAllocated(_loadedDistribs, __FILE__, __LINE__);
+      _loadedDictIdx = new (std::nothrow) unsigned long[_distribCount+1];
+      assertMemoryIsAllocated(_loadedDictIdx, __FILE__, __LINE__);
+    }
+    for (unsigned long i=0; i<_distribCount; i++)
+      _loadedDistribs[i] = NULL;
+    _pLoadedServer = &ms;
+  }
+  MixtureGD& m = ms.createMixtureGD(0);
+  char* id = new (std::nothrow) char[length+1];
+  assertMemoryIsAllocated(id, __FILE__, __LINE__);
+  memcpy(id, _pStringPool+offset, length);
+  id[length] = 0;
+  ms.setMixtureId(m, id);
+  delete [] id;
+  for (unsigned long c=0; c<count; c++)
+  {
+    const unsigned long i = getUInt4(_pDictIdxVect, first+c);
+    if (!shareDistribs)
+    {
+      m.addDistrib(K::k, ms.getDistrib(i), _weightVect[first+c]);
+      continue;
+    }
+    // the distribution may have been removed from the server since
+    DistribGD* p = _loadedDistribs[i];
+    if (p == NULL || _loadedDictIdx[i] >= ms.getDistribCount() ||
+        &ms.getDistrib(_loadedDictIdx[i]) != p)
+    {
+      p = &loadDistrib(ms, i);
+      _loadedDistribs[i] = p;
+      _loadedDictIdx[i] = p->dictIndex(K::k);
+    }
+    m.addDistrib(K::k, *p, _weightVect[first+c]);
+  }
+  return m;
+}
+//-------------------------------------------------------------------------
+void R::error(const String& msg) // private
+{
+  assert(_pReader != NULL);
+  throw InvalidDataException(msg, __FILE__, __LINE__,
+                             _pReader->getFullFileName());
+}
+//-------------------------------------------------------------------------
+String R::getClassName() const { return "MixtureServerFileReaderBinary"; }
+//-------------------------------------------------------------------------
+R::~MixtureServerFileReaderBinary()
+{
+  delete [] reinterpret_cast<double*>(_pOwnedData);
+  delete [] _loadedDistribs;
+  delete [] _loadedDictIdx;
+}
+//-------------------------------------------------------------------------
+
+#endif // !defined(ALIZE_MixtureServerFileReaderBinary_cpp)
@@ -87,9 +87,8 @@ R& R::create(const FileName& f, const Config& c)
 void R::readMixtureServer(MixtureServer& ms)
 {
   assert(_pReader != NULL);
-  _line = 1;
   _pMixtureServer = &ms;
-  parse();
+  parse(*_pReader);
   _pReader->close();
 }
 //-------------------------------------------------------------------------
@@ -337,18 +336,9 @@ void R::eventError(const String& msg)
   _pReader->close();
   _pMixtureServer->reset();
   _pMixtureServer->setServerName("");
-  throw InvalidDataException("Error line " + String::valueOf(_line)
+  throw InvalidDataException("Error line " + String::valueOf(getLine())
            + " : " + msg, __FILE__, __LINE__, _pReader->getFullFileName());
 }
-//-------------------------------------------------------------------------
-const String& R::readOneChar()
-{
-  assert(_pReader != NULL);
-  const String& s = _pReader->readString(1);
-  if (s == "\n")
-    _line++;
-  return s;
-}
 
 //-------------------------------------------------------------------------
 Mixture& R::getMixture()
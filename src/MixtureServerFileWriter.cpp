@@ -55,7 +55,11 @@
 #if !defined(ALIZE_MixtureServerFileWriter_cpp)
 #define ALIZE_MixtureServerFileWriter_cpp
 
+#include <new>
+#include <memory.h>
+#include <stdint.h>
 #include "MixtureServerFileWriter.h"
+#include "MixtureServerFileReaderBinary.h"
 #include "MixtureGD.h"
 #include "DistribGD.h"
 #include "Exception.h"
@@ -77,6 +81,8 @@ W::MixtureServerFileWriter(const FileName& f, const Config& c)
       _format = MixtureServerFileWriterFormat_RAW;
     else if (c.getParam_saveMixtureServerFileFormat() == MixtureServerFileWriterFormat_XML)
       _format = MixtureServerFileWriterFormat_XML; // TODO : gerer des param dans la config
+    else if (c.getParam_saveMixtureServerFileFormat() == MixtureServerFileWriterFormat_BINARY)
+      _format = MixtureServerFileWriterFormat_BINARY;
   }
 }
 //-------------------------------------------------------------------------
@@ -93,6 +99,8 @@ void W::writeMixtureServer(const MixtureServer& ms)
   open(); //can throw IOException
   if (_format == MixtureServerFileWriterFormat_XML)
     writeMixtureServerXml(ms);
+  else if (_format == MixtureServerFileWriterFormat_BINARY)
+    writeMixtureServerBinary(ms);
   else
     writeMixtureServerRaw(ms);
   close();
@@ -235,6 +243,167 @@ void W::writeMixtureGDRaw(const MixtureGD& m)
   }
 }
 //-------------------------------------------------------------------------
+void W::writeMixtureServerBinary(const MixtureServer& ms)
+{ // see MixtureServerFileReaderBinary for the format
+  unsigned long i, c;
+  const unsigned long distribCount = ms.getDistribCount();
+  const unsigned long mixtureCount = ms.getMixtureCount();
+  unsigned long vectSize = 0;
+  if (distribCount != 0)
+    vectSize = ms.getVectSize();
+  const unsigned long stride = (vectSize+7) & ~7UL;
+  unsigned long componentCount = 0;
+  uint64_t stringPoolLength = ms.getServerName().length();
+  for (i=0; i<distribCount; i++)
+    if (dynamic_cast<const DistribGD*>(&ms.getDistrib(i)) == NULL)
+      throw Exception("I don't know how to save a "
+               + ms.getDistrib(i).getClassName()
+               + " object", __FILE__, __LINE__);
+  for (i=0; i<mixtureCount; i++)
+  {
+    const Mixture& m = ms.getMixture(i);
+    if (dynamic_cast<const MixtureGD*>(&m) == NULL)
+      throw Exception("I don't know how to save a "
+               + m.getClassName() + " object", __FILE__, __LINE__);
+    componentCount += m.getDistribCount();
+    stringPoolLength += m.getId().length();
+  }
+  if (stringPoolLength > 0xFFFFFFFFUL)
+    throw Exception("Too many mixture ids", __FILE__, __LINE__);
+  unsigned long hashTableSize = 2;
+  while (hashTableSize < 2*mixtureCount)
+    hashTableSize *= 2;
+
+  // offsets of the arrays
+  uint64_t offsets[8];
+  const uint64_t sizes[8] = {
+    (uint64_t)distribCount*stride*sizeof(double),
+    (uint64_t)distribCount*stride*sizeof(double),
+    (uint64_t)distribCount*2*sizeof(double),
+    (uint64_t)mixtureCount*4*4,
+    (uint64_t)componentCount*4,
+    (uint64_t)componentCount*sizeof(double),
+    (uint64_t)hashTableSize*4,
+    stringPoolLength };
+  uint64_t pos = 128;
+  for (i=0; i<8; i++)
+  {
+    offsets[i] = pos;
+    pos = (pos + sizes[i] + 63) & ~(uint64_t)63;
+  }
+
+  // header
+  char header[128];
+  memset(header, 0, sizeof(header));
+  memcpy(header, "ALIZEMSB", 8);
+  const uint32_t h[10] = { 1, 0x01020304, (uint32_t)vectSize,
+    (uint32_t)stride, (uint32_t)distribCount, (uint32_t)mixtureCount,
+    (uint32_t)componentCount, (uint32_t)hashTableSize,
+    (uint32_t)ms.getServerName().length(), (uint32_t)stringPoolLength };
+  memcpy(header+8, h, sizeof(h));
+  memcpy(header+48, offsets, sizeof(offsets));
+  pos = 0;
+  writeBytes(header, sizeof(header), pos);
+
+  // parameters of the distributions
+  const double zero[8] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+  writePadding(offsets[0], pos);
+  for (i=0; i<distribCount; i++)
+  {
+    writeBytes(ms.getDistrib(i).getMeanVect().getArray(),
+               vectSize*sizeof(double), pos);
+    writeBytes(zero, (stride-vectSize)*sizeof(double), pos);
+  }
+  writePadding(offsets[1], pos);
+  for (i=0; i<distribCount; i++)
+  {
+    const DistribGD& d = static_cast<const DistribGD&>(ms.getDistrib(i));
+    writeBytes(d.getCovInvVect().getArray(), vectSize*sizeof(double), pos);
+    writeBytes(zero, (stride-vectSize)*sizeof(double), pos);
+  }
+  writePadding(offsets[2], pos);
+  for (i=0; i<distribCount; i++)
+  {
+    const Distrib& d = ms.getDistrib(i);
+    const double detCst[2] = { d.getDet(), d.getCst() };
+    writeBytes(detCst, sizeof(detCst), pos);
+  }
+
+  // mixtures
+  writePadding(offsets[3], pos);
+  uint32_t first = 0, idOffset = ms.getServerName().length();
+  for (i=0; i<mixtureCount; i++)
+  {
+    const Mixture& m = ms.getMixture(i);
+    const uint32_t r[4] = { first, (uint32_t)m.getDistribCount(), idOffset,
+                            (uint32_t)m.getId().length() };
+    writeBytes(r, sizeof(r), pos);
+    first += r[1];
+    idOffset += r[3];
+  }
+  writePadding(offsets[4], pos);
+  for (i=0; i<mixtureCount; i++)
+  {
+    const MixtureGD& m = static_cast<const MixtureGD&>(ms.getMixture(i));
+    for (c=0; c<m.getDistribCount(); c++)
+    {
+      const uint32_t dictIdx = m.getDistrib(c).dictIndex(K::k);
+      writeBytes(&dictIdx, 4, pos);
+    }
+  }
+  writePadding(offsets[5], pos);
+  for (i=0; i<mixtureCount; i++)
+  {
+    const Mixture& m = ms.getMixture(i);
+    for (c=0; c<m.getDistribCount(); c++)
+    {
+      const double w = m.weight(c);
+      writeBytes(&w, sizeof(w), pos);
+    }
+  }
+
+  // id index : the first mixture with a given id is found
+  uint32_t* table = new (std::nothrow) uint32_t[hashTableSize];
+  assertMemoryIsAllocated(table, __FILE__, __LINE__);
+  memset(table, 0xFF, hashTableSize*4);
+  for (i=0; i<mixtureCount; i++)
+  {
+    const String& id = ms.getMixture(i).getId();
+    unsigned long s = MixtureServerFileReaderBinary::hashId(id)
+                      & (hashTableSize-1);
+    while (table[s] != 0xFFFFFFFF && ms.getMixture(table[s]).getId() != id)
+      s = (s+1) & (hashTableSize-1);
+    if (table[s] == 0xFFFFFFFF)
+      table[s] = i;
+  }
+  writePadding(offsets[6], pos);
+  try { writeBytes(table, hashTableSize*4, pos); }
+  catch (Exception&) { delete [] table; throw; }
+  delete [] table;
+
+  // string pool
+  writePadding(offsets[7], pos);
+  writeBytes(ms.getServerName().c_str(), ms.getServerName().length(), pos);
+  for (i=0; i<mixtureCount; i++)
+  {
+    const String& id = ms.getMixture(i).getId();
+    writeBytes(id.c_str(), id.length(), pos);
+  }
+}
+//-------------------------------------------------------------------------
+void W::writeBytes(const void* p, unsigned long n, uint64_t& pos)
+{ // private
+  FileWriter::writeBytes(p, n);
+  pos += n;
+}
+//-------------------------------------------------------------------------
+void W::writePadding(uint64_t offset, uint64_t& pos) // private
+{
+  const char zero[64] = {0};
+  assert(offset >= pos && offset-pos <= 64);
+  writeBytes(zero, (unsigned long)(offset-pos), pos);
+}
+//-------------------------------------------------------------------------
 String W::getClassName() const { return "MixtureServerFileWriter"; }
 //-------------------------------------------------------------------------
 W::~MixtureServerFileWriter() {}
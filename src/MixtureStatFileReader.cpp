@@ -0,0 +1,171 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+
+#if !defined(ALIZE_MixtureStatFileReader_cpp)
+#define ALIZE_MixtureStatFileReader_cpp
+
+#include "MixtureStatFileReader.h"
+#include "MixtureStatFileWriter.h"
+#include "MixtureGDStat.h"
+#include "MixtureGFStat.h"
+#include "MixtureGD.h"
+#include "MixtureGF.h"
+#include "DistribGD.h"
+#include "DistribGF.h"
+#include "FileReader.h"
+#include "RealVector.h"
+#include "alizeString.h"
+#include "Exception.h"
+
+using namespace alize;
+typedef MixtureStatFileReader R;
+
+//-------------------------------------------------------------------------
+R::MixtureStatFileReader(const FileName& f)
+:Object(), _pReader(&FileReader::create(f, "", "", false)) {}
+//-------------------------------------------------------------------------
+void R::readAccEM(MixtureStat& s)
+{
+  MixtureGDStat* pGD = dynamic_cast<MixtureGDStat*>(&s);
+  MixtureGFStat* pGF = dynamic_cast<MixtureGFStat*>(&s);
+  if (pGD == NULL && pGF == NULL)
+    throw Exception("I don't know how to load a " + s.getClassName()
+                    + " object", __FILE__, __LINE__);
+  s.assertResetEMDone();
+  const Mixture& m = (pGD != NULL ? (const Mixture&)pGD->getInternalAccumEM()
+                                  : (const Mixture&)pGF->getInternalAccumEM());
+  const unsigned long distribCount = m.getDistribCount();
+  const unsigned long vectSize = m.getVectSize();
+  const unsigned long covSize = pGD != NULL ? vectSize : vectSize*vectSize;
+  const String fileName = _pReader->getFileName();
+  unsigned long c, i;
+
+  // header
+  _pReader->reset();
+  _pReader->swap() = false;
+  if (_pReader->readString(8) != "ALIZEACC")
+    throw Exception("'" + fileName + "' is not an accumulator file",
+                    __FILE__, __LINE__);
+  unsigned long version = _pReader->readUInt4();
+  if (version == 0x01000000UL) // other byte order
+  {
+    _pReader->swap() = true;
+    version = 1;
+  }
+  if (version != 1)
+    throw Exception("'" + fileName + "' : unsupported version "
+                    + String::valueOf(version), __FILE__, __LINE__);
+  if (_pReader->readChar() != (pGD != NULL ? 'D' : 'F'))
+    throw Exception("'" + fileName + "' : wrong distribution type",
+                    __FILE__, __LINE__);
+  if (_pReader->readUInt4() != distribCount ||
+      _pReader->readUInt4() != vectSize)
+    throw Exception("'" + fileName + "' : distribCount or vectSize"
+                    " mismatch", __FILE__, __LINE__);
+  if (_pReader->readUInt4() !=
+      MixtureStatFileWriter::computeModelKey(s.getMixture()))
+    throw Exception("'" + fileName + "' has been computed from another"
+                    " model", __FILE__, __LINE__);
+
+  // data are read before modifying the accumulators
+  const real_t featureCountForEM = _pReader->readDouble();
+  const real_t featureCountForOcc = _pReader->readDouble();
+  DoubleVector occVect(distribCount, distribCount);
+  for (c=0; c<distribCount; c++)
+    occVect[c] = _pReader->readDouble();
+  DoubleVector accVect(distribCount*(vectSize+covSize),
+                       distribCount*(vectSize+covSize));
+  real_t* p = accVect.getArray();
+  for (i=0; i<accVect.size(); i++)
+    p[i] = _pReader->readDouble();
+  _pReader->close();
+
+  s._accumulatedOccVect += occVect;
+  s._featureCounterForAccumulatedOcc += featureCountForOcc;
+  s._featureCounterForEM += featureCountForEM;
+  for (c=0; c<distribCount; c++)
+  {
+    Distrib& d = m.getDistrib(c);
+    real_t* meanVect = d.getMeanVect().getArray(); // renews the stamp
+    real_t* covVect;
+    if (pGD != NULL)
+      covVect = static_cast<DistribGD&>(d).getCovVect().getArray();
+    else
+      covVect = static_cast<DistribGF&>(d).getCovMatrix().getArray();
+    for (i=0; i<vectSize; i++)
+      meanVect[i] += *p++;
+    i = 0;
+    if (pGF != NULL) // the first value is a constant (see resetEM())
+    {
+      i++;
+      p++;
+    }
+    for (; i<covSize; i++)
+      covVect[i] += *p++;
+  }
+}
+//-------------------------------------------------------------------------
+String R::getClassName() const { return "MixtureStatFileReader"; }
+//-------------------------------------------------------------------------
+String R::toString() const
+{
+  return Object::toString()
+    + "\n  fileName = '" + _pReader->getFileName() + "'";
+}
+//-------------------------------------------------------------------------
+R::~MixtureStatFileReader() { delete _pReader; }
+//-------------------------------------------------------------------------
+
+#endif // !defined(ALIZE_MixtureStatFileReader_cpp)
@@ -0,0 +1,160 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+
+#if !defined(ALIZE_MixtureStatFileWriter_cpp)
+#define ALIZE_MixtureStatFileWriter_cpp
+
+#include <memory.h>
+#include <stdint.h>
+#include "MixtureStatFileWriter.h"
+#include "MixtureGDStat.h"
+#include "MixtureGFStat.h"
+#include "MixtureGD.h"
+#include "MixtureGF.h"
+#include "DistribGD.h"
+#include "DistribGF.h"
+#include "Exception.h"
+
+using namespace alize;
+typedef MixtureStatFileWriter W;
+
+//-------------------------------------------------------------------------
+W::MixtureStatFileWriter(const FileName& f)
+:FileWriter(f) {}
+//-------------------------------------------------------------------------
+void W::writeAccEM(MixtureStat& s)
+{
+  MixtureGDStat* pGD = dynamic_cast<MixtureGDStat*>(&s);
+  MixtureGFStat* pGF = dynamic_cast<MixtureGFStat*>(&s);
+  if (pGD == NULL && pGF == NULL)
+    throw Exception("I don't know how to save a " + s.getClassName()
+                    + " object", __FILE__, __LINE__);
+  const Mixture& m = (pGD != NULL ? (const Mixture&)pGD->getInternalAccumEM()
+                                  : (const Mixture&)pGF->getInternalAccumEM());
+  const unsigned long distribCount = m.getDistribCount();
+  const unsigned long vectSize = m.getVectSize();
+
+  open(); //can throw IOException
+  writeString("ALIZEACC");
+  writeUInt4(1); // version
+  writeChar(pGD != NULL ? 'D' : 'F');
+  writeUInt4(distribCount);
+  writeUInt4(vectSize);
+  writeUInt4(computeModelKey(s.getMixture()));
+  writeDouble(s.getEMFeatureCount());
+  writeDouble(s.getAccumulatedOccFeatureCount());
+  writeDoubles(s.getAccumulatedOccVect().getArray(), distribCount);
+  for (unsigned long c=0; c<distribCount; c++)
+  {
+    const Distrib& d = m.getDistrib(c);
+    writeDoubles(d.getMeanVect().getArray(), vectSize);
+    if (pGD != NULL)
+      writeDoubles(static_cast<const DistribGD&>(d).getCovVect().getArray(),
+                   vectSize);
+    else
+      writeDoubles(static_cast<const DistribGF&>(d).getCovMatrix()
+                   .getArray(), vectSize*vectSize);
+  }
+  close();
+}
+//-------------------------------------------------------------------------
+void W::writeDoubles(const real_t* v, unsigned long n) // private
+{
+  writeBytes(v, n*sizeof(real_t));
+}
+//-------------------------------------------------------------------------
+// FNV-1a of the little-endian bytes of n doubles, so that the key does
+// not depend on the byte order of the machine
+static unsigned long hashDoubles(unsigned long key, const double* v,
+                                 unsigned long n)
+{
+  for (unsigned long i=0; i<n; i++)
+  {
+    uint64_t bits;
+    memcpy(&bits, v+i, sizeof(bits));
+    for (unsigned long j=0; j<8; j++)
+      key = ((key ^ (unsigned long)((bits >> 8*j) & 0xff)) * 16777619UL)
+            & 0xffffffffUL;
+  }
+  return key;
+}
+//-------------------------------------------------------------------------
+unsigned long W::computeModelKey(const Mixture& m)
+{
+  unsigned long key = 2166136261UL;
+  const unsigned long vectSize = m.getVectSize();
+  const bool isGD = (m.getType() == DistribType_GD);
+  for (unsigned long c=0; c<m.getDistribCount(); c++)
+  {
+    const Distrib& d = m.getDistrib(c);
+    const double wc[2] = { m.weight(c), d.getCst() };
+    key = hashDoubles(key, wc, 2);
+    key = hashDoubles(key, d.getMeanVect().getArray(), vectSize);
+    if (isGD)
+      key = hashDoubles(key, static_cast<const DistribGD&>(d)
+                        .getCovInvVect().getArray(), vectSize);
+    else
+      key = hashDoubles(key, static_cast<const DistribGF&>(d)
+                        .getCovInvMatrix().getArray(), vectSize*vectSize);
+  }
+  return key;
+}
+//-------------------------------------------------------------------------
+String W::getClassName() const { return "MixtureStatFileWriter"; }
+//-------------------------------------------------------------------------
+W::~MixtureStatFileWriter() {}
+//-------------------------------------------------------------------------
+
+#endif // !defined(ALIZE_MixtureStatFileWriter_cpp)
@@ -61,10 +61,49 @@
 
 #include <cstdlib> // for exit()
 #include <cstdio>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
 #include "Object.h"
 #include "alizeString.h"
 #include "Exception.h"
 
+//-------------------------------------------------------------------------
+// atomic operations on the counters shared by the threads. v += n and
+// returns the new value
+static inline unsigned long atomicAdd(unsigned long& v, unsigned long n)
+{
+#if defined(__GNUC__)
+  return __sync_add_and_fetch(&v, n);
+#elif defined(_MSC_VER) // unsigned long is 32 bits wide
+  return (unsigned long)_InterlockedExchangeAdd(
+                  reinterpret_cast<volatile long*>(&v), (long)n) + n;
+#else
+  return v += n;
+#endif
+}
+//-------------------------------------------------------------------------
+// v = max(v, n)
+static inline void atomicMax(unsigned long& v, unsigned long n)
+{
+  unsigned long old = atomicAdd(v, 0);
+  while (n > old)
+  {
+#if defined(__GNUC__)
+    unsigned long prev = __sync_val_compare_and_swap(&v, old, n);
+#elif defined(_MSC_VER)
+    unsigned long prev = (unsigned long)_InterlockedCompareExchange(
+                  reinterpret_cast<volatile long*>(&v), (long)n, (long)old);
+#else
+    unsigned long prev = v;
+    v = n;
+#endif
+    if (prev == old)
+      break;
+    old = prev;
+  }
+}
+
 using namespace alize;
 
 #if !defined(NDEBUG)
@@ -108,10 +147,8 @@ Object::Object()
   }
 
 #if !defined NDEBUG
-  _creationCounter++;
-  unsigned long diff = _creationCounter-_destructionCounter;
-  if (diff > _max)
-    _max = diff;
+  unsigned long created = atomicAdd(_creationCounter, 1);
+  atomicMax(_max, created-atomicAdd(_destructionCounter, 0));
 #endif
 }
 //-------------------------------------------------------------------------
@@ -155,6 +192,47 @@ void Object::assertMemoryIsAllocated(const void* p, const char* f, int l)
 unsigned long Object::max(unsigned long a, unsigned long b)
 { return (a>=b?a:b); }
 //-------------------------------------------------------------------------
+unsigned long Object::atomicIncrement(unsigned long& v)
+{ return atomicAdd(v, 1); }
+//-------------------------------------------------------------------------
+unsigned long Object::atomicLoad(const unsigned long& v)
+{
+#if defined(__GNUC__)
+  return __atomic_load_n(&v, __ATOMIC_ACQUIRE);
+#elif defined(_MSC_VER) // volatile accesses are acquire/release
+  return *reinterpret_cast<const volatile unsigned long*>(&v);
+#else
+  return v;
+#endif
+}
+//-------------------------------------------------------------------------
+void Object::atomicStore(unsigned long& v, unsigned long n)
+{
+#if defined(__GNUC__)
+  __atomic_store_n(&v, n, __ATOMIC_RELEASE);
+#elif defined(_MSC_VER)
+  *reinterpret_cast<volatile unsigned long*>(&v) = n;
+#else
+  v = n;
+#endif
+}
+//-------------------------------------------------------------------------
+bool Object::atomicCompareAndSwap(unsigned long& v, unsigned long old,
+                                  unsigned long n)
+{
+#if defined(__GNUC__)
+  return __sync_bool_compare_and_swap(&v, old, n);
+#elif defined(_MSC_VER)
+  return (unsigned long)_InterlockedCompareExchange(
+         reinterpret_cast<volatile long*>(&v), (long)n, (long)old) == old;
+#else
+  if (v != old)
+    return false;
+  v = n;
+  return true;
+#endif
+}
+//-------------------------------------------------------------------------
 String Object::getParamTypeName(ParamType t)
 {
   if (t == PARAMTYPE_INTEGER)
@@ -191,6 +269,8 @@ MixtureServerFileWriterFormat Object::getMixtureServerFileWriterFormat(const Str
     return MixtureServerFileWriterFormat_XML;
   if (name == "RAW")
     return MixtureServerFileWriterFormat_RAW;
+  if (name == "BINARY")
+    return MixtureServerFileWriterFormat_BINARY;
   throw Exception("Unavailable mixture file format name '" + name + "'",
                             __FILE__, __LINE__);
   return MixtureServerFileWriterFormat_RAW; // never called
@@ -224,6 +304,8 @@ FeatureFileReaderFormat Object::getFeatureFileReaderFormat(const String& name)
     return FeatureFileReaderFormat_RAW;
   if (name == "HTK")
     return FeatureFileReaderFormat_HTK;
+  if (name == "COMPRESSED")
+    return FeatureFileReaderFormat_COMPRESSED;
   throw Exception("Unavailable feature file format name '" + name + "'",
                             __FILE__, __LINE__);
   return FeatureFileReaderFormat_RAW; // never called
@@ -299,11 +381,24 @@ FeatureFileWriterFormat Object::getFeatureFileWriterFormat(const String& name)
     return FeatureFileWriterFormat_SPRO4;
   if (name == "RAW")
     return FeatureFileWriterFormat_RAW;
+  if (name == "COMPRESSED")
+    return FeatureFileWriterFormat_COMPRESSED;
   throw Exception("Unavailable feature file format name '" + name + "'",
                             __FILE__, __LINE__);
   return FeatureFileWriterFormat_RAW; // never called
 }
 //-------------------------------------------------------------------------
+FeatureFileCompression Object::getFeatureFileCompression(const String& name)
+{
+  if (name == "FLOAT16")
+    return FeatureFileCompression_FLOAT16;
+  if (name == "INT16")
+    return FeatureFileCompression_INT16;
+  throw Exception("Unavailable feature file compression name '" + name
+                  + "'", __FILE__, __LINE__);
+  return FeatureFileCompression_FLOAT16; // never called
+}
+//-------------------------------------------------------------------------
 MixtureFileReaderFormat Object::getMixtureFileReaderFormat(const String& name)
 {
   if (name == "AMIRAL")
@@ -320,10 +415,7 @@ MixtureFileReaderFormat Object::getMixtureFileReaderFormat(const String& name)
 Object::~Object()
 {
 #if !defined NDEBUG
-  _destructionCounter++;
-  unsigned long diff = _creationCounter-_destructionCounter;
-  if (diff > _max)
-    _max = diff;
+  atomicAdd(_destructionCounter, 1); // cannot raise _max
 #endif
 }
 //-------------------------------------------------------------------------
@@ -0,0 +1,799 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+#if !defined(ALIZE_SimdKernels_cpp)
+#define ALIZE_SimdKernels_cpp
+
+#include <cstring>
+#include "SimdKernels.h"
+#include "Exception.h"
+
+// the vectorized implementations need the GCC "target" attribute
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define ALIZE_SIMD_X86
+#include <immintrin.h>
+#endif
+
+using namespace alize;
+typedef SimdKernels S;
+
+typedef real_t (*DiagQuadFormFunction)(const real_t*, const real_t*,
+                                       const real_t*, unsigned long);
+typedef real_t (*DotFunction)(const real_t*, const real_t*, unsigned long);
+typedef float (*DiagQuadFormFloatFunction)(const float*, const float*,
+                                           const float*, unsigned long);
+typedef void (*CholeskyQuadFormVectFunction)(const real_t*, const real_t*,
+                            const real_t*, unsigned long, real_t*, real_t*);
+typedef unsigned long (*FindGreaterOrEqualFunction)(const real_t*,
+                                     unsigned long, unsigned long, real_t);
+typedef void (*Swap8BytesFunction)(void*, unsigned long);
+typedef void (*HalfToFloatFunction)(const unsigned short*, float*,
+                                    unsigned long);
+typedef void (*FloatToHalfFunction)(const float*, unsigned short*,
+                                    unsigned long);
+typedef void (*DequantizeFunction)(const short*, const float*, const float*,
+                                   unsigned long, unsigned long, float*);
+
+struct KernelTable
+{
+  const char*                  name;
+  DiagQuadFormFunction         diagQuadForm;
+  DotFunction                  dot;
+  DiagQuadFormFloatFunction    diagQuadFormFloat;
+  CholeskyQuadFormVectFunction choleskyQuadFormVect;
+  FindGreaterOrEqualFunction   findGreaterOrEqual;
+  Swap8BytesFunction           swap8Bytes;
+  HalfToFloatFunction          halfToFloat;
+  FloatToHalfFunction          floatToHalf;
+  DequantizeFunction           dequantize;
+};
+
+static const unsigned long BATCH = SimdKernels::CHOLESKY_BATCH_SIZE;
+
+//-------------------------------------------------------------------------
+static real_t diagQuadFormGeneric(const real_t* x, const real_t* m,
+                                  const real_t* c, unsigned long n)
+{
+  real_t s = 0.0;
+  for (unsigned long i=0; i<n; i++)
+    s += (x[i] - m[i]) * (x[i] - m[i]) * c[i];
+  return s;
+}
+//-------------------------------------------------------------------------
+static float diagQuadFormFloatGeneric(const float* x, const float* m,
+                                      const float* c, unsigned long n)
+{
+  float s = 0.0f;
+  for (unsigned long i=0; i<n; i++)
+    s += (x[i] - m[i]) * (x[i] - m[i]) * c[i];
+  return s;
+}
+//-------------------------------------------------------------------------
+static real_t dotGeneric(const real_t* a, const real_t* b, unsigned long n)
+{
+  real_t s = 0.0;
+  for (unsigned long i=0; i<n; i++)
+    s += a[i] * b[i];
+  return s;
+}
+//-------------------------------------------------------------------------
+// r[k*BATCH+j] = x[j*n+k] - m[k]
+static void transposeDiff(const real_t* x, const real_t* m, unsigned long n,
+                          real_t* r)
+{
+  for (unsigned long k=0; k<n; k++)
+    for (unsigned long j=0; j<BATCH; j++)
+      r[k*BATCH+j] = x[j*n+k] - m[k];
+}
+//-------------------------------------------------------------------------
+// l is packed column by column. Column i : 1/L(i,i) then L(k,i) for k > i
+// r[k*BATCH+j] is the value k of the feature j
+static void choleskyQuadFormVectGeneric(const real_t* x, const real_t* m,
+               const real_t* l, unsigned long n, real_t* r, real_t* q)
+{
+  transposeDiff(x, m, n, r);
+  unsigned long i, j, k;
+  for (j=0; j<BATCH; j++)
+    q[j] = 0.0;
+  for (i=0; i<n; l+=n-i, i++)
+  {
+    real_t y[BATCH];
+    for (j=0; j<BATCH; j++)
+    {
+      y[j] = r[i*BATCH+j] * l[0];
+      q[j] += y[j]*y[j];
+    }
+    for (k=i+1; k<n; k++)
+      for (j=0; j<BATCH; j++)
+        r[k*BATCH+j] -= l[k-i]*y[j];
+  }
+}
+//-------------------------------------------------------------------------
+static void swap8BytesGeneric(void* v, unsigned long n)
+{
+  char* p = static_cast<char*>(v);
+  for (unsigned long i=0; i<n; i++, p+=8)
+  {
+    char t;
+    t = p[7]; p[7] = p[0]; p[0] = t;
+    t = p[6]; p[6] = p[1]; p[1] = t;
+    t = p[5]; p[5] = p[2]; p[2] = t;
+    t = p[4]; p[4] = p[3]; p[3] = t;
+  }
+}
+//-------------------------------------------------------------------------
+static float halfToFloatValue(unsigned short h)
+{
+  const unsigned int sign = (unsigned int)(h & 0x8000) << 16;
+  unsigned int e = (h >> 10) & 0x1f;
+  unsigned int m = h & 0x3ff;
+  unsigned int bits;
+  if (e == 0x1f) // infinite or NaN (always quiet, as F16C does)
+    bits = sign | 0x7f800000 | (m << 13) | (m != 0 ? 0x400000 : 0);
+  else if (e != 0) // normal
+    bits = sign | ((e+112) << 23) | (m << 13);
+  else if (m == 0) // zero
+    bits = sign;
+  else // subnormal : becomes a normal single precision value
+  {
+    e = 113;
+    while ((m & 0x400) == 0)
+    {
+      m <<= 1;
+      e--;
+    }
+    bits = sign | (e << 23) | ((m & 0x3ff) << 13);
+  }
+  float f;
+  memcpy(&f, &bits, 4);
+  return f;
+}
+//-------------------------------------------------------------------------
+static unsigned short floatToHalfValue(float f)
+{
+  unsigned int x;
+  memcpy(&x, &f, 4);
+  const unsigned int sign = (x >> 16) & 0x8000;
+  const unsigned int a = x & 0x7fffffff;
+  if (a >= 0x7f800000) // infinite or NaN
+    return (unsigned short)(sign | 0x7c00 | (a > 0x7f800000 ?
+                                       0x200 | ((a >> 13) & 0x3ff) : 0));
+  if (a >= 0x477ff000) // >= 65520 : rounded to infinite
+    return (unsigned short)(sign | 0x7c00);
+  if (a >= 0x38800000) // normal half precision value
+  {
+    // changes the exponent bias and rounds the mantissa
+    const unsigned int r = a - 0x38000000 + 0xfff + ((a >> 13) & 1);
+    return (unsigned short)(sign | (r >> 13));
+  }
+  if (a <= 0x33000000) // <= 2^-25 : rounded to zero
+    return (unsigned short)sign;
+  // subnormal half precision value
+  const unsigned int s = 126 - (a >> 23);
+  const unsigned int m = (a & 0x7fffff) | 0x800000;
+  unsigned int r = m >> s;
+  const unsigned int rest = m & ((1u << s) - 1);
+  const unsigned int half = 1u << (s-1);
+  if (rest > half || (rest == half && (r & 1) != 0))
+    r++;
+  return (unsigned short)(sign | r);
+}
+//-------------------------------------------------------------------------
+static void halfToFloatGeneric(const unsigned short* h, float* f,
+                               unsigned long n)
+{
+  for (unsigned long i=0; i<n; i++)
+    f[i] = halfToFloatValue(h[i]);
+}
+//-------------------------------------------------------------------------
+static void floatToHalfGeneric(const float* f, unsigned short* h,
+                               unsigned long n)
+{
+  for (unsigned long i=0; i<n; i++)
+    h[i] = floatToHalfValue(f[i]);
+}
+//-------------------------------------------------------------------------
+static void dequantizeGeneric(const short* q, const float* scale,
+                              const float* offset, unsigned long n,
+                              unsigned long count, float* f)
+{
+  for (unsigned long t=0; t<count; t++, q+=n, f+=n)
+    for (unsigned long i=0; i<n; i++)
+      f[i] = (float)q[i]*scale[i] + offset[i];
+}
+//-------------------------------------------------------------------------
+static unsigned long findGreaterOrEqualGeneric(const real_t* v,
+                     unsigned long n, unsigned long stride, real_t t)
+{
+  for (unsigned long i=0; i<n; i++)
+    if (v[i*stride] >= t)
+      return i;
+  return n;
+}
+#if defined(ALIZE_SIMD_X86)
+//-------------------------------------------------------------------------
+__attribute__((target("sse2")))
+static real_t diagQuadFormSse2(const real_t* x, const real_t* m,
+                               const real_t* c, unsigned long n)
+{
+  __m128d s0 = _mm_setzero_pd(), s1 = _mm_setzero_pd();
+  unsigned long i = 0;
+  for (; i+4<=n; i+=4)
+  {
+    __m128d d0 = _mm_sub_pd(_mm_loadu_pd(x+i), _mm_loadu_pd(m+i));
+    __m128d d1 = _mm_sub_pd(_mm_loadu_pd(x+i+2), _mm_loadu_pd(m+i+2));
+    s0 = _mm_add_pd(s0, _mm_mul_pd(_mm_mul_pd(d0, d0), _mm_loadu_pd(c+i)));
+    s1 = _mm_add_pd(s1, _mm_mul_pd(_mm_mul_pd(d1, d1),
+                                   _mm_loadu_pd(c+i+2)));
+  }
+  double r[2];
+  _mm_storeu_pd(r, _mm_add_pd(s0, s1));
+  real_t s = r[0] + r[1];
+  for (; i<n; i++)
+    s += (x[i] - m[i]) * (x[i] - m[i]) * c[i];
+  return s;
+}
+//-------------------------------------------------------------------------
+__attribute__((target("sse2")))
+static float diagQuadFormFloatSse2(const float* x, const float* m,
+                                   const float* c, unsigned long n)
+{
+  __m128 s0 = _mm_setzero_ps(), s1 = _mm_setzero_ps();
+  unsigned long i = 0;
+  for (; i+8<=n; i+=8)
+  {
+    __m128 d0 = _mm_sub_ps(_mm_loadu_ps(x+i), _mm_loadu_ps(m+i));
+    __m128 d1 = _mm_sub_ps(_mm_loadu_ps(x+i+4), _mm_loadu_ps(m+i+4));
+    s0 = _mm_add_ps(s0, _mm_mul_ps(_mm_mul_ps(d0, d0), _mm_loadu_ps(c+i)));
+    s1 = _mm_add_ps(s1, _mm_mul_ps(_mm_mul_ps(d1, d1), _mm_loadu_ps(c+i+4)));
+  }
+  float r[4];
+  _mm_storeu_ps(r, _mm_add_ps(s0, s1));
+  float s = (r[0] + r[1]) + (r[2] + r[3]);
+  for (; i<n; i++)
+    s += (x[i] - m[i]) * (x[i] - m[i]) * c[i];
+  return s;
+}
+//-------------------------------------------------------------------------
+__attribute__((target("sse2")))
+static real_t dotSse2(const real_t* a, const real_t* b, unsigned long n)
+{
+  __m128d s0 = _mm_setzero_pd(), s1 = _mm_setzero_pd();
+  unsigned long i = 0;
+  for (; i+4<=n; i+=4)
+  {
+    s0 = _mm_add_pd(s0, _mm_mul_pd(_mm_loadu_pd(a+i), _mm_loadu_pd(b+i)));
+    s1 = _mm_add_pd(s1, _mm_mul_pd(_mm_loadu_pd(a+i+2),
+                                   _mm_loadu_pd(b+i+2)));
+  }
+  double r[2];
+  _mm_storeu_pd(r, _mm_add_pd(s0, s1));
+  real_t s = r[0] + r[1];
+  for (; i<n; i++)
+    s += a[i] * b[i];
+  return s;
+}
+//-------------------------------------------------------------------------
+__attribute__((target("avx2,fma")))
+static real_t sumAvx2(__m256d v)
+{
+  __m128d h = _mm_add_pd(_mm256_castpd256_pd128(v),
+                         _mm256_extractf128_pd(v, 1));
+  return _mm_cvtsd_f64(_mm_add_sd(h, _mm_unpackhi_pd(h, h)));
+}
+//-------------------------------------------------------------------------
+__attribute__((target("avx2,fma")))
+static real_t diagQuadFormAvx2(const real_t* x, const real_t* m,
+                               const real_t* c, unsigned long n)
+{
+  __m256d s0 = _mm256_setzero_pd(), s1 = _mm256_setzero_pd();
+  unsigned long i = 0;
+  for (; i+8<=n; i+=8)
+  {
+    __m256d d0 = _mm256_sub_pd(_mm256_loadu_pd(x+i), _mm256_loadu_pd(m+i));
+    __m256d d1 = _mm256_sub_pd(_mm256_loadu_pd(x+i+4),
+                               _mm256_loadu_pd(m+i+4));
+    s0 = _mm256_fmadd_pd(_mm256_mul_pd(d0, d0), _mm256_loadu_pd(c+i), s0);
+    s1 = _mm256_fmadd_pd(_mm256_mul_pd(d1, d1), _mm256_loadu_pd(c+i+4), s1);
+  }
+  if (i+4 <= n)
+  {
+    __m256d d0 = _mm256_sub_pd(_mm256_loadu_pd(x+i), _mm256_loadu_pd(m+i));
+    s0 = _mm256_fmadd_pd(_mm256_mul_pd(d0, d0), _mm256_loadu_pd(c+i), s0);
+    i += 4;
+  }
+  real_t s = sumAvx2(_mm256_add_pd(s0, s1));
+  for (; i<n; i++)
+    s += (x[i] - m[i]) * (x[i] - m[i]) * c[i];
+  return s;
+}
+//-------------------------------------------------------------------------
+__attribute__((target("avx2,fma")))
+static float diagQuadFormFloatAvx2(const float* x, const float* m,
+                                   const float* c, unsigned long n)
+{
+  __m256 s0 = _mm256_setzero_ps(), s1 = _mm256_setzero_ps();
+  unsigned long i = 0;
+  for (; i+16<=n; i+=16)
+  {
+    __m256 d0 = _mm256_sub_ps(_mm256_loadu_ps(x+i), _mm256_loadu_ps(m+i));
+    __m256 d1 = _mm256_sub_ps(_mm256_loadu_ps(x+i+8),
+                              _mm256_loadu_ps(m+i+8));
+    s0 = _mm256_fmadd_ps(_mm256_mul_ps(d0, d0), _mm256_loadu_ps(c+i), s0);
+    s1 = _mm256_fmadd_ps(_mm256_mul_ps(d1, d1), _mm256_loadu_ps(c+i+8), s1);
+  }
+  if (i+8 <= n)
+  {
+    __m256 d0 = _mm256_sub_ps(_mm256_loadu_ps(x+i), _mm256_loadu_ps(m+i));
+    s0 = _mm256_fmadd_ps(_mm256_mul_ps(d0, d0), _mm256_loadu_ps(c+i), s0);
+    i += 8;
+  }
+  __m256 v = _mm256_add_ps(s0, s1);
+  __m128 h = _mm_add_ps(_mm256_castps256_ps128(v),
+                        _mm256_extractf128_ps(v, 1));
+  h = _mm_add_ps(h, _mm_movehl_ps(h, h));
+  float s = _mm_cvtss_f32(_mm_add_ss(h, _mm_shuffle_ps(h, h, 1)));
+  for (; i<n; i++)
+    s += (x[i] - m[i]) * (x[i] - m[i]) * c[i];
+  return s;
+}
+//-------------------------------------------------------------------------
+__attribute__((target("avx2,fma")))
+static real_t dotAvx2(const real_t* a, const real_t* b, unsigned long n)
+{
+  __m256d s0 = _mm256_setzero_pd(), s1 = _mm256_setzero_pd();
+  unsigned long i = 0;
+  for (; i+8<=n; i+=8)
+  {
+    s0 = _mm256_fmadd_pd(_mm256_loadu_pd(a+i), _mm256_loadu_pd(b+i), s0);
+    s1 = _mm256_fmadd_pd(_mm256_loadu_pd(a+i+4), _mm256_loadu_pd(b+i+4),
+                         s1);
+  }
+  if (i+4 <= n)
+  {
+    s0 = _mm256_fmadd_pd(_mm256_loadu_pd(a+i), _mm256_loadu_pd(b+i), s0);
+    i += 4;
+  }
+  real_t s = sumAvx2(_mm256_add_pd(s0, s1));
+  for (; i<n; i++)
+    s += a[i] * b[i];
+  return s;
+}
+//-------------------------------------------------------------------------
+__attribute__((target("avx512f")))
+static real_t sumAvx512(__m512d v)
+{
+  // the masked extracts avoid _mm256_undefined_pd(), which the plain
+  // extract and cast intrinsics use and gcc reports as uninitialized
+  const __m256d z = _mm256_setzero_pd();
+  __m256d q = _mm256_add_pd(_mm512_mask_extractf64x4_pd(z, 0xF, v, 0),
+                            _mm512_mask_extractf64x4_pd(z, 0xF, v, 1));
+  __m128d h = _mm_add_pd(_mm256_castpd256_pd128(q),
+                         _mm256_extractf128_pd(q, 1));
+  return _mm_cvtsd_f64(_mm_add_sd(h, _mm_unpackhi_pd(h, h)));
+}
+//-------------------------------------------------------------------------
+__attribute__((target("avx512f")))
+static real_t diagQuadFormAvx512(const real_t* x, const real_t* m,
+                                 const real_t* c, unsigned long n)
+{
+  __m512d s0 = _mm512_setzero_pd(), s1 = _mm512_setzero_pd();
+  unsigned long i = 0;
+  for (; i+16<=n; i+=16)
+  {
+    __m512d d0 = _mm512_sub_pd(_mm512_loadu_pd(x+i), _mm512_loadu_pd(m+i));
+    __m512d d1 = _mm512_sub_pd(_mm512_loadu_pd(x+i+8),
+                               _mm512_loadu_pd(m+i+8));
+    s0 = _mm512_fmadd_pd(_mm512_mul_pd(d0, d0), _mm512_loadu_pd(c+i), s0);
+    s1 = _mm512_fmadd_pd(_mm512_mul_pd(d1, d1), _mm512_loadu_pd(c+i+8), s1);
+  }
+  for (; i<n; i+=8)
+  {
+    // the last values are loaded with a mask
+    __mmask8 k = (n-i >= 8) ? (__mmask8)0xFF : (__mmask8)((1U<<(n-i))-1);
+    __m512d d0 = _mm512_sub_pd(_mm512_maskz_loadu_pd(k, x+i),
+                               _mm512_maskz_loadu_pd(k, m+i));
+    s0 = _mm512_fmadd_pd(_mm512_mul_pd(d0, d0),
+                         _mm512_maskz_loadu_pd(k, c+i), s0);
+  }
+  return sumAvx512(_mm512_add_pd(s0, s1));
+}
+//-------------------------------------------------------------------------
+__attribute__((target("avx512f")))
+static float sumFloatAvx512(__m512 v)
+{
+  // same extracts as sumAvx512(), on the float values seen as doubles
+  const __m256d z = _mm256_setzero_pd();
+  __m512d d = _mm512_castps_pd(v);
+  __m256 q = _mm256_add_ps(
+      _mm256_castpd_ps(_mm512_mask_extractf64x4_pd(z, 0xF, d, 0)),
+      _mm256_castpd_ps(_mm512_mask_extractf64x4_pd(z, 0xF, d, 1)));
+  __m128 h = _mm_add_ps(_mm256_castps256_ps128(q),
+                        _mm256_extractf128_ps(q, 1));
+  h = _mm_add_ps(h, _mm_movehl_ps(h, h));
+  return _mm_cvtss_f32(_mm_add_ss(h, _mm_shuffle_ps(h, h, 1)));
+}
+//-------------------------------------------------------------------------
+__attribute__((target("avx512f")))
+static float diagQuadFormFloatAvx512(const float* x, const float* m,
+                                     const float* c, unsigned long n)
+{
+  __m512 s0 = _mm512_setzero_ps();
+  for (unsigned long i=0; i<n; i+=16)
+  {
+    __mmask16 k = (n-i >= 16) ? (__mmask16)0xFFFF
+                              : (__mmask16)((1U<<(n-i))-1);
+    __m512 d0 = _mm512_sub_ps(_mm512_maskz_loadu_ps(k, x+i),
+                              _mm512_maskz_loadu_ps(k, m+i));
+    s0 = _mm512_fmadd_ps(_mm512_mul_ps(d0, d0),
+                         _mm512_maskz_loadu_ps(k, c+i), s0);
+  }
+  return sumFloatAvx512(s0);
+}
+//-------------------------------------------------------------------------
+__attribute__((target("avx512f")))
+static real_t dotAvx512(const real_t* a, const real_t* b, unsigned long n)
+{
+  __m512d s0 = _mm512_setzero_pd(), s1 = _mm512_setzero_pd();
+  unsigned long i = 0;
+  for (; i+16<=n; i+=16)
+  {
+    s0 = _mm512_fmadd_pd(_mm512_loadu_pd(a+i), _mm512_loadu_pd(b+i), s0);
+    s1 = _mm512_fmadd_pd(_mm512_loadu_pd(a+i+8), _mm512_loadu_pd(b+i+8),
+                         s1);
+  }
+  for (; i<n; i+=8)
+  {
+    __mmask8 k = (n-i >= 8) ? (__mmask8)0xFF : (__mmask8)((1U<<(n-i))-1);
+    s0 = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(k, a+i),
+                         _mm512_maskz_loadu_pd(k, b+i), s0);
+  }
+  return sumAvx512(_mm512_add_pd(s0, s1));
+}
+//-------------------------------------------------------------------------
+__attribute__((target("sse2")))
+static void choleskyQuadFormVectSse2(const real_t* x, const real_t* m,
+               const real_t* l, unsigned long n, real_t* r, real_t* q)
+{
+  transposeDiff(x, m, n, r);
+  __m128d s[4], y[4];
+  unsigned long i, j, k;
+  for (j=0; j<4; j++)
+    s[j] = _mm_setzero_pd();
+  for (i=0; i<n; l+=n-i, i++)
+  {
+    const __m128d d = _mm_set1_pd(l[0]);
+    for (j=0; j<4; j++)
+    {
+      y[j] = _mm_mul_pd(_mm_loadu_pd(r+i*BATCH+2*j), d);
+      s[j] = _mm_add_pd(s[j], _mm_mul_pd(y[j], y[j]));
+    }
+    for (k=i+1; k<n; k++)
+    {
+      const __m128d lk = _mm_set1_pd(l[k-i]);
+      real_t* rk = r+k*BATCH;
+      for (j=0; j<4; j++)
+        _mm_storeu_pd(rk+2*j, _mm_sub_pd(_mm_loadu_pd(rk+2*j),
+                                         _mm_mul_pd(lk, y[j])));
+    }
+  }
+  for (j=0; j<4; j++)
+    _mm_storeu_pd(q+2*j, s[j]);
+}
+//-------------------------------------------------------------------------
+__attribute__((target("avx2,fma")))
+static void choleskyQuadFormVectAvx2(const real_t* x, const real_t* m,
+               const real_t* l, unsigned long n, real_t* r, real_t* q)
+{
+  transposeDiff(x, m, n, r);
+  __m256d s0 = _mm256_setzero_pd(), s1 = _mm256_setzero_pd();
+  for (unsigned long i=0; i<n; l+=n-i, i++)
+  {
+    const __m256d d = _mm256_set1_pd(l[0]);
+    const __m256d y0 = _mm256_mul_pd(_mm256_loadu_pd(r+i*BATCH), d);
+    const __m256d y1 = _mm256_mul_pd(_mm256_loadu_pd(r+i*BATCH+4), d);
+    s0 = _mm256_fmadd_pd(y0, y0, s0);
+    s1 = _mm256_fmadd_pd(y1, y1, s1);
+    for (unsigned long k=i+1; k<n; k++)
+    {
+      const __m256d lk = _mm256_set1_pd(l[k-i]);
+      real_t* rk = r+k*BATCH;
+      _mm256_storeu_pd(rk, _mm256_fnmadd_pd(lk, y0, _mm256_loadu_pd(rk)));
+      _mm256_storeu_pd(rk+4, _mm256_fnmadd_pd(lk, y1,
+                                              _mm256_loadu_pd(rk+4)));
+    }
+  }
+  _mm256_storeu_pd(q, s0);
+  _mm256_storeu_pd(q+4, s1);
+}
+//-------------------------------------------------------------------------
+__attribute__((target("avx512f")))
+static void choleskyQuadFormVectAvx512(const real_t* x, const real_t* m,
+               const real_t* l, unsigned long n, real_t* r, real_t* q)
+{
+  transposeDiff(x, m, n, r);
+  __m512d s = _mm512_setzero_pd();
+  for (unsigned long i=0; i<n; l+=n-i, i++)
+  {
+    const __m512d y = _mm512_mul_pd(_mm512_loadu_pd(r+i*BATCH),
+                                    _mm512_set1_pd(l[0]));
+    s = _mm512_fmadd_pd(y, y, s);
+    for (unsigned long k=i+1; k<n; k++)
+      _mm512_storeu_pd(r+k*BATCH, _mm512_fnmadd_pd(_mm512_set1_pd(l[k-i]),
+                                   y, _mm512_loadu_pd(r+k*BATCH)));
+  }
+  _mm512_storeu_pd(q, s);
+}
+//-------------------------------------------------------------------------
+__attribute__((target("avx2,fma")))
+static unsigned long findGreaterOrEqualAvx2(const real_t* v,
+                     unsigned long n, unsigned long stride, real_t t)
+{
+  const __m256d vt = _mm256_set1_pd(t);
+  const long long s = (long long)stride;
+  const __m256i idx = _mm256_set_epi64x(3*s, 2*s, s, 0);
+  unsigned long i = 0;
+  for (; i+4<=n; i+=4)
+  {
+    __m256d x = _mm256_i64gather_pd(v+i*stride, idx, 8);
+    int mask = _mm256_movemask_pd(_mm256_cmp_pd(x, vt, _CMP_GE_OQ));
+    if (mask != 0)
+      return i + __builtin_ctz(mask);
+  }
+  for (; i<n; i++)
+    if (v[i*stride] >= t)
+      return i;
+  return n;
+}
+//-------------------------------------------------------------------------
+__attribute__((target("avx512f")))
+static unsigned long findGreaterOrEqualAvx512(const real_t* v,
+                     unsigned long n, unsigned long stride, real_t t)
+{
+  const __m512d vt = _mm512_set1_pd(t);
+  const long long s = (long long)stride;
+  const __m512i idx = _mm512_set_epi64(7*s, 6*s, 5*s, 4*s, 3*s, 2*s, s, 0);
+  for (unsigned long i=0; i<n; i+=8)
+  {
+    // the last values are gathered with a mask
+    __mmask8 k = (n-i >= 8) ? (__mmask8)0xFF : (__mmask8)((1U<<(n-i))-1);
+    __m512d x = _mm512_mask_i64gather_pd(vt, k, idx, v+i*stride, 8);
+    __mmask8 mask = _mm512_mask_cmp_pd_mask(k, x, vt, _CMP_GE_OQ);
+    if (mask != 0)
+      return i + __builtin_ctz(mask);
+  }
+  return n;
+}
+//-------------------------------------------------------------------------
+__attribute__((target("avx2")))
+static void swap8BytesAvx2(void* v, unsigned long n)
+{
+  // reverses the 8 bytes of each 64-bit lane
+  const __m256i mask = _mm256_set_epi8(
+          8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7,
+          8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7);
+  char* p = static_cast<char*>(v);
+  unsigned long i = 0;
+  for (; i+4<=n; i+=4, p+=32)
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), _mm256_shuffle_epi8(
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)), mask));
+  swap8BytesGeneric(p, n-i);
+}
+//-------------------------------------------------------------------------
+__attribute__((target("avx2,f16c")))
+static void halfToFloatAvx2(const unsigned short* h, float* f,
+                            unsigned long n)
+{
+  unsigned long i = 0;
+  for (; i+8<=n; i+=8)
+    _mm256_storeu_ps(f+i, _mm256_cvtph_ps(
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(h+i))));
+  // not emitted by the compiler before the tail call to the SSE code
+  _mm256_zeroupper();
+  halfToFloatGeneric(h+i, f+i, n-i);
+}
+//-------------------------------------------------------------------------
+__attribute__((target("avx2,f16c")))
+static void floatToHalfAvx2(const float* f, unsigned short* h,
+                            unsigned long n)
+{
+  unsigned long i = 0;
+  for (; i+8<=n; i+=8)
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(h+i), _mm256_cvtps_ph(
+          _mm256_loadu_ps(f+i), _MM_FROUND_TO_NEAREST_INT));
+  _mm256_zeroupper(); // see halfToFloatAvx2()
+  floatToHalfGeneric(f+i, h+i, n-i);
+}
+//-------------------------------------------------------------------------
+// no "fma" target : the products and the sums are rounded separately, as
+// in the generic version
+__attribute__((target("avx2")))
+static void dequantizeAvx2(const short* q, const float* scale,
+                           const float* offset, unsigned long n,
+                           unsigned long count, float* f)
+{
+  for (unsigned long t=0; t<count; t++, q+=n, f+=n)
+  {
+    unsigned long i = 0;
+    for (; i+8<=n; i+=8)
+    {
+      const __m256 v = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(q+i))));
+      _mm256_storeu_ps(f+i, _mm256_add_ps(_mm256_mul_ps(v,
+            _mm256_loadu_ps(scale+i)), _mm256_loadu_ps(offset+i)));
+    }
+    for (; i<n; i++)
+      f[i] = (float)q[i]*scale[i] + offset[i];
+  }
+}
+#endif // defined(ALIZE_SIMD_X86)
+//-------------------------------------------------------------------------
+// ordered from the best to the worst
+static const KernelTable kernelTables[] =
+{
+#if defined(ALIZE_SIMD_X86)
+  { "avx512", diagQuadFormAvx512, dotAvx512, diagQuadFormFloatAvx512,
+    choleskyQuadFormVectAvx512, findGreaterOrEqualAvx512, swap8BytesAvx2,
+    halfToFloatAvx2, floatToHalfAvx2, dequantizeAvx2 },
+  { "avx2",   diagQuadFormAvx2,   dotAvx2,   diagQuadFormFloatAvx2,
+    choleskyQuadFormVectAvx2, findGreaterOrEqualAvx2, swap8BytesAvx2,
+    halfToFloatAvx2, floatToHalfAvx2, dequantizeAvx2 },
+  { "sse2",   diagQuadFormSse2,   dotSse2,   diagQuadFormFloatSse2,
+    choleskyQuadFormVectSse2, findGreaterOrEqualGeneric, swap8BytesGeneric,
+    halfToFloatGeneric, floatToHalfGeneric, dequantizeGeneric },
+#endif
+  { "generic", diagQuadFormGeneric, dotGeneric, diagQuadFormFloatGeneric,
+    choleskyQuadFormVectGeneric, findGreaterOrEqualGeneric,
+    swap8BytesGeneric, halfToFloatGeneric, floatToHalfGeneric,
+    dequantizeGeneric }
+};
+static const unsigned long kernelTableCount =
+                           sizeof(kernelTables)/sizeof(KernelTable);
+//-------------------------------------------------------------------------
+static bool isSupported(const KernelTable& t)
+{
+#if defined(ALIZE_SIMD_X86)
+  __builtin_cpu_init();
+  const String name(t.name);
+  if (name == "avx512") // the conversions use avx2 and f16c
+    return __builtin_cpu_supports("avx512f") &&
+           __builtin_cpu_supports("avx2") && __builtin_cpu_supports("f16c");
+  if (name == "avx2")
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")
+        && __builtin_cpu_supports("f16c");
+  if (name == "sse2")
+    return __builtin_cpu_supports("sse2");
+#endif
+  return true;
+}
+//-------------------------------------------------------------------------
+static const KernelTable* selectBestKernel()
+{
+  unsigned long i = 0;
+  while (!isSupported(kernelTables[i]))
+    i++; // the last one is always supported
+  return &kernelTables[i];
+}
+//-------------------------------------------------------------------------
+// the selected table. Initialized at first use
+static const KernelTable*& selectedKernel()
+{
+  static const KernelTable* p = selectBestKernel();
+  return p;
+}
+//-------------------------------------------------------------------------
+real_t S::diagQuadForm(const real_t* x, const real_t* m, const real_t* c,
+                       unsigned long n)
+{ return selectedKernel()->diagQuadForm(x, m, c, n); }
+//-------------------------------------------------------------------------
+float S::diagQuadForm(const float* x, const float* m, const float* c,
+                      unsigned long n)
+{ return selectedKernel()->diagQuadFormFloat(x, m, c, n); }
+//-------------------------------------------------------------------------
+real_t S::fullQuadForm(const real_t* d, const real_t* c, unsigned long n)
+{
+  DotFunction dot = selectedKernel()->dot;
+  real_t s = 0.0;
+  for (unsigned long i=0; i<n; i++)
+    s += dot(c+i*n, d, n) * d[i];
+  return s;
+}
+//-------------------------------------------------------------------------
+void S::choleskyQuadFormVect(const real_t* x, const real_t* m,
+               const real_t* l, unsigned long n, real_t* r, real_t* q)
+{ selectedKernel()->choleskyQuadFormVect(x, m, l, n, r, q); }
+//-------------------------------------------------------------------------
+unsigned long S::findGreaterOrEqual(const real_t* v, unsigned long n,
+                                    unsigned long stride, real_t t)
+{ return selectedKernel()->findGreaterOrEqual(v, n, stride, t); }
+//-------------------------------------------------------------------------
+void S::swap8Bytes(void* v, unsigned long n)
+{ selectedKernel()->swap8Bytes(v, n); }
+//-------------------------------------------------------------------------
+void S::halfToFloat(const unsigned short* h, float* f, unsigned long n)
+{ selectedKernel()->halfToFloat(h, f, n); }
+//-------------------------------------------------------------------------
+void S::floatToHalf(const float* f, unsigned short* h, unsigned long n)
+{ selectedKernel()->floatToHalf(f, h, n); }
+//-------------------------------------------------------------------------
+void S::dequantize(const short* q, const float* scale, const float* offset,
+                   unsigned long n, unsigned long count, float* f)
+{ selectedKernel()->dequantize(q, scale, offset, n, count, f); }
+//-------------------------------------------------------------------------
+String S::getKernelName() { return selectedKernel()->name; }
+//-------------------------------------------------------------------------
+bool S::isKernelSupported(const String& name)
+{
+  for (unsigned long i=0; i<kernelTableCount; i++)
+    if (name == kernelTables[i].name)
+      return isSupported(kernelTables[i]);
+  return false;
+}
+//-------------------------------------------------------------------------
+void S::setKernel(const String& name)
+{
+  for (unsigned long i=0; i<kernelTableCount; i++)
+    if (name == kernelTables[i].name)
+    {
+      if (!isSupported(kernelTables[i]))
+        throw Exception("kernel '" + name
+            + "' is not supported by the processor", __FILE__, __LINE__);
+      selectedKernel() = &kernelTables[i];
+      return;
+    }
+  throw Exception("unknown kernel '" + name + "'", __FILE__, __LINE__);
+}
+//-------------------------------------------------------------------------
+
+#endif // !defined(ALIZE_SimdKernels_cpp)
@@ -74,6 +74,7 @@
 #include "MixtureGDStat.h"
 #include "MixtureGFStat.h"
 #include "Mixture.h"
+#include "MixtureGD.h"
 #include "Exception.h"
 #include "Config.h"
 #include "RealVector.h"
@@ -81,6 +82,14 @@
 #include "ViterbiAccum.h"
 #include "FrameAccGD.h"
 #include "FrameAccGF.h"
+#include "FeatureBlock.h"
+#include "FloatFeatureBlock.h"
+#include "MixtureGDPacked.h"
+#include "MixtureGDPackedSet.h"
+#include "MixtureGDTree.h"
+#include "TaskPool.h"
+#include "Gemm.h"
+#include "SimdKernels.h"
 
 using namespace alize;
 using namespace std;
@@ -91,18 +100,184 @@ using namespace std;
 
 
 typedef StatServer S;
+
+// number of features of a block processed together by computeLLK()
+static const unsigned long FEATURE_TILE_SIZE = 128;
+
+// number of distributions scored by a task of computeAllDistribLK()
+static const unsigned long DISTRIB_LK_GRAIN = 64;
+
+//-------------------------------------------------------------------------
+// computes the likelihoods of a range of distributions of a server
+namespace
+{
+  class DistribLKTask : public TaskPool::Task
+  {
+  public :
+    DistribLKTask(const MixtureServer& ms, const Feature& f, lk_t* lkVect)
+    :_ms(ms), _f(f), _lkVect(lkVect) {}
+
+    virtual void run(unsigned long first, unsigned long last, unsigned long)
+    {
+      for (unsigned long i=first; i<last; i++)
+        _lkVect[i] = _ms.getDistrib(i).computeLK(_f);
+    }
+  private :
+    const MixtureServer& _ms;
+    const Feature&       _f;
+    lk_t*                _lkVect;
+  };
+}
+
+//-------------------------------------------------------------------------
+// sum*exp(max) += w*exp(logLk) without overflow or underflow.
+// sum == 0 means that nothing has been added yet
+static inline void addLogLK(lk_t logLk, weight_t w, lk_t& max, lk_t& sum)
+{
+  if (sum == 0.0)
+  {
+    max = logLk;
+    sum = w;
+  }
+  else if (logLk > max)
+  {
+    sum = sum*exp(max-logLk) + w;
+    max = logLk;
+  }
+  else
+    sum += w*exp(logLk-max);
+}
+//-------------------------------------------------------------------------
+static void assertIsUpToDate(const MixtureGDPacked& p, unsigned long vectSize)
+{
+  if (!p.isUpToDate())
+    throw Exception("compiled mixture '" + p.getMixture().getId()
+        + "' is out of date : call update()", __FILE__, __LINE__);
+  if (p.getVectSize() != vectSize)
+    throw Exception("mixture vectSize ("
+        + String::valueOf(p.getVectSize()) + ") != feature vectSize ("
+        + String::valueOf(vectSize) + ")", __FILE__, __LINE__);
+}
+//-------------------------------------------------------------------------
+// lk[t] += sum of weighted likelihoods of the feature t of x
+void S::accumulateLK(const MixtureGDPacked& p, const real_t* x,
+                     unsigned long featureCount, lk_t* lk) // private
+{
+  const unsigned long vectSize = p.getVectSize();
+  const unsigned long stride = p.getStride();
+  const unsigned long distribCount = p.getDistribCount();
+  const real_t* m = p.getMeanMatrix();
+  const real_t* ci = p.getCovInvMatrix();
+  const weight_t* w = p.getWeightVect();
+  const real_t* cst = p.getCstVect();
+
+  for (unsigned long c=0; c<distribCount; c++, m+=stride, ci+=stride)
+  {
+    const real_t* f = x;
+    for (unsigned long t=0; t<featureCount; t++, f+=vectSize)
+    {
+      real_t tmp = SimdKernels::diagQuadForm(f, m, ci, vectSize);
+      tmp = cst[c] * exp(-0.5*tmp);
+      if (ISNAN(tmp))
+        tmp = EPS_LK;
+      lk[t] += w[c] * tmp;
+    }
+  }
+}
+//-------------------------------------------------------------------------
+// log-domain version of accumulateLK()
+void S::accumulateLogLK(const MixtureGDPacked& p, const real_t* x,
+      unsigned long featureCount, lk_t* maxVect, lk_t* sumVect) // private
+{
+  const unsigned long vectSize = p.getVectSize();
+  const unsigned long stride = p.getStride();
+  const unsigned long distribCount = p.getDistribCount();
+  const real_t* m = p.getMeanMatrix();
+  const real_t* ci = p.getCovInvMatrix();
+  const weight_t* w = p.getWeightVect();
+  const real_t* lwc = p.getLogWeightCstVect();
+
+  for (unsigned long c=0; c<distribCount; c++, m+=stride, ci+=stride)
+  {
+    if (w[c] <= 0.0)
+      continue;
+    const real_t* f = x;
+    for (unsigned long t=0; t<featureCount; t++, f+=vectSize)
+    {
+      real_t tmp = SimdKernels::diagQuadForm(f, m, ci, vectSize);
+      addLogLK(lwc[c] - 0.5*tmp, 1.0, maxVect[t], sumVect[t]);
+    }
+  }
+}
+//-------------------------------------------------------------------------
+// single precision version of accumulateLogLK()
+void S::accumulateLogLK(const MixtureGDPacked& p, const float* x,
+      unsigned long featureCount, lk_t* maxVect, lk_t* sumVect) // private
+{
+  const unsigned long vectSize = p.getVectSize();
+  const unsigned long stride = p.getFloatStride();
+  const unsigned long distribCount = p.getDistribCount();
+  const float* m = p.getFloatMeanMatrix();
+  const float* ci = p.getFloatCovInvMatrix();
+  const weight_t* w = p.getWeightVect();
+  const real_t* lwc = p.getLogWeightCstVect();
+
+  for (unsigned long c=0; c<distribCount; c++, m+=stride, ci+=stride)
+  {
+    if (w[c] <= 0.0)
+      continue;
+    const float* f = x;
+    for (unsigned long t=0; t<featureCount; t++, f+=vectSize)
+    {
+      real_t tmp = SimdKernels::diagQuadForm(f, m, ci, vectSize);
+      addLogLK(lwc[c] - 0.5*tmp, 1.0, maxVect[t], sumVect[t]);
+    }
+  }
+}
+//-------------------------------------------------------------------------
+// zMatr : rows of 2*stride values (x^2, x) with zero padding
+void S::computeLogLKMatrix(const MixtureGDPacked& p, const real_t* x,
+    unsigned long featureCount, real_t* zMatr, lk_t* logLkMatr) // private
+{
+  const unsigned long vectSize = p.getVectSize();
+  const unsigned long stride = p.getStride();
+  const unsigned long distribCount = p.getDistribCount();
+  const real_t* k = p.getGemmCstVect();
+  unsigned long t, i;
+
+  for (t=0; t<featureCount; t++, x+=vectSize)
+  {
+    real_t* z = zMatr + 2*t*stride;
+    for (i=0; i<vectSize; i++)
+    {
+      z[i] = x[i]*x[i];
+      z[stride+i] = x[i];
+    }
+  }
+  Gemm::multiplyByTransposed(featureCount, distribCount, 2*stride, zMatr,
+      2*stride, p.getGemmMatrix(), 2*stride, logLkMatr, distribCount);
+  for (t=0; t<featureCount; t++, logLkMatr+=distribCount)
+    for (unsigned long c=0; c<distribCount; c++)
+      logLkMatr[c] += k[c];
+}
 //-------------------------------------------------------------------------
 S::StatServer(const Config& c)
 :Object(), _config(c), _pMixtureServer(NULL), 
 _topDistribsVect(0, 0), _minLLK(c.getParam_minLLK()), 
-_maxLLK(c.getParam_maxLLK()){ 
+_maxLLK(c.getParam_maxLLK()),
+_computeLLKInLogDomain(c.existsParam_computeLLKInLogDomain &&
+                       c.getParam_computeLLKInLogDomain()),
+_pTaskPool(NULL), _ownTaskPool(false){ 
 	reset(); 
 	}
 //-------------------------------------------------------------------------
 S::StatServer(const Config& c, MixtureServer& ms)
 :Object(), _config(c), _pMixtureServer(&ms),
  _topDistribsVect(0, 0), _minLLK(c.getParam_minLLK()),
-_maxLLK(c.getParam_maxLLK())
+_maxLLK(c.getParam_maxLLK()),
+_computeLLKInLogDomain(c.existsParam_computeLLKInLogDomain &&
+                       c.getParam_computeLLKInLogDomain()),
+_pTaskPool(NULL), _ownTaskPool(false)
 
 { reset(); }
 //-------------------------------------------------------------------------
@@ -113,6 +288,13 @@ void S::reset()
   _pLastMixture = NULL;
   _pLastMixtureStat = NULL;
   _topDistribsVect.clear();
+  _topDistribsTreeVect.deleteAllObjects();
+  if (_ownTaskPool) // rebuilt by computeAllDistribLK() if needed
+  {
+    delete _pTaskPool;
+    _pTaskPool = NULL;
+    _ownTaskPool = false;
+  }
 }
 //-------------------------------------------------------------------------
 real_t S::getAccumulatedOccFeatureCount(const Mixture& m)
@@ -152,6 +334,14 @@ lk_t S::computeLLK(const Mixture& m, const Feature& f) const
   weight_t*  w = m.getTabWeight().getArray();
   Distrib**  d = m.getTabDistrib();
   unsigned long distribCount = m.getDistribCount();
+  if (_computeLLKInLogDomain)
+  {
+    lk_t max = 0.0;
+    for (unsigned long c=0; c<distribCount; c++)
+      if (w[c] > 0.0)
+        addLogLK(d[c]->computeLogLK(f), w[c], max, lk);
+    return computeLLK(max, lk);
+  }
   for (unsigned long c=0; c<distribCount; c++) {
     lk += w[c] * d[c]->computeLK(f);
   }
@@ -169,6 +359,185 @@ lk_t S::computeLLK(const Mixture& m, const Feature& f, unsigned long idx) const
   return computeLLK(lk);
 }
 //-------------------------------------------------------------------------
+void S::computeLLK(const Mixture& m, const FeatureBlock& b,
+                   DoubleVector& llkVect) const
+{
+  if (b.getVectSize() != m.getVectSize())
+    throw Exception("mixture vectSize ("
+        + String::valueOf(m.getVectSize()) + ") != block vectSize ("
+        + String::valueOf(b.getVectSize()) + ")", __FILE__, __LINE__);
+  const unsigned long featureCount = b.getFeatureCount();
+  llkVect.setSize(featureCount);
+  llkVect.setAllValues(0.0);
+  lk_t* lk = llkVect.getArray();
+  weight_t*  w = m.getTabWeight().getArray();
+  Distrib**  d = m.getTabDistrib();
+  unsigned long distribCount = m.getDistribCount();
+
+  if (_computeLLKInLogDomain)
+  {
+    lk_t logLk[FEATURE_TILE_SIZE], max[FEATURE_TILE_SIZE];
+    for (unsigned long t=0; t<featureCount; t+=FEATURE_TILE_SIZE)
+    {
+      unsigned long i, n = featureCount-t;
+      if (n > FEATURE_TILE_SIZE)
+        n = FEATURE_TILE_SIZE;
+      for (unsigned long c=0; c<distribCount; c++)
+      {
+        if (w[c] <= 0.0)
+          continue;
+        d[c]->computeLogLKVect(b, t, n, logLk);
+        for (i=0; i<n; i++)
+          addLogLK(logLk[i], w[c], max[i], lk[t+i]);
+      }
+      for (i=0; i<n; i++)
+        lk[t+i] = computeLLK(max[i], lk[t+i]);
+    }
+    return;
+  }
+  for (unsigned long t=0; t<featureCount; t+=FEATURE_TILE_SIZE)
+  {
+    unsigned long n = featureCount-t;
+    if (n > FEATURE_TILE_SIZE)
+      n = FEATURE_TILE_SIZE;
+    for (unsigned long c=0; c<distribCount; c++)
+      d[c]->computeAndAccumulateLK(b, t, n, w[c], lk);
+  }
+  for (unsigned long t=0; t<featureCount; t++)
+    lk[t] = computeLLK(lk[t]);
+}
+//-------------------------------------------------------------------------
+lk_t S::computeLLK(const MixtureGDPacked& p, const Feature& f) const
+{
+  assertIsUpToDate(p, f.getVectSize());
+  lk_t lk = 0.0;
+  if (_computeLLKInLogDomain)
+  {
+    lk_t max = 0.0;
+    accumulateLogLK(p, f.getDataVector(), 1, &max, &lk);
+    return computeLLK(max, lk);
+  }
+  accumulateLK(p, f.getDataVector(), 1, &lk);
+  return computeLLK(lk);
+}
+//-------------------------------------------------------------------------
+void S::computeLLK(const MixtureGDPacked& p, const FeatureBlock& b,
+                   DoubleVector& llkVect) const
+{
+  const unsigned long vectSize = b.getVectSize();
+  assertIsUpToDate(p, vectSize);
+  const unsigned long featureCount = b.getFeatureCount();
+  llkVect.setSize(featureCount);
+  llkVect.setAllValues(0.0);
+  lk_t* lk = llkVect.getArray();
+
+  if (_computeLLKInLogDomain)
+  {
+    lk_t max[FEATURE_TILE_SIZE];
+    for (unsigned long t=0; t<featureCount; t+=FEATURE_TILE_SIZE)
+    {
+      unsigned long n = featureCount-t;
+      if (n > FEATURE_TILE_SIZE)
+        n = FEATURE_TILE_SIZE;
+      accumulateLogLK(p, b.getFeatureVector(t), n, max, lk+t);
+      for (unsigned long i=0; i<n; i++)
+        lk[t+i] = computeLLK(max[i], lk[t+i]);
+    }
+    return;
+  }
+  for (unsigned long t=0; t<featureCount; t+=FEATURE_TILE_SIZE)
+  {
+    unsigned long n = featureCount-t;
+    if (n > FEATURE_TILE_SIZE)
+      n = FEATURE_TILE_SIZE;
+    accumulateLK(p, b.getFeatureVector(t), n, lk+t);
+  }
+  for (unsigned long t=0; t<featureCount; t++)
+    lk[t] = computeLLK(lk[t]);
+}
+//-------------------------------------------------------------------------
+void S::computeLLK(const MixtureGDPacked& p, const FloatFeatureBlock& b,
+                   DoubleVector& llkVect) const
+{
+  assertIsUpToDate(p, b.getVectSize());
+  const unsigned long featureCount = b.getFeatureCount();
+  llkVect.setSize(featureCount);
+  llkVect.setAllValues(0.0);
+  lk_t* lk = llkVect.getArray();
+  lk_t max[FEATURE_TILE_SIZE];
+
+  for (unsigned long t=0; t<featureCount; t+=FEATURE_TILE_SIZE)
+  {
+    unsigned long n = featureCount-t;
+    if (n > FEATURE_TILE_SIZE)
+      n = FEATURE_TILE_SIZE;
+    accumulateLogLK(p, b.getFeatureVector(t), n, max, lk+t);
+    for (unsigned long i=0; i<n; i++)
+      lk[t+i] = computeLLK(max[i], lk[t+i]);
+  }
+}
+//-------------------------------------------------------------------------
+void S::computeLogLKMatrix(const MixtureGDPacked& p, const FeatureBlock& b,
+                           unsigned long first, unsigned long count,
+                           DoubleVector& logLkMatr) const
+{
+  assertIsUpToDate(p, b.getVectSize());
+  logLkMatr.setSize(count*p.getDistribCount());
+  if (count == 0)
+    return;
+  assertIsInBounds(__FILE__, __LINE__, first+count-1, b.getFeatureCount());
+  DoubleVector zMatr(2*p.getStride()*count, 2*p.getStride()*count);
+  zMatr.setAllValues(0.0);
+  computeLogLKMatrix(p, b.getFeatureVector(first), count,
+                     zMatr.getArray(), logLkMatr.getArray());
+}
+//-------------------------------------------------------------------------
+void S::computeLLKWithGemm(const MixtureGDPacked& p, const FeatureBlock& b,
+                           DoubleVector& llkVect) const
+{
+  assertIsUpToDate(p, b.getVectSize());
+  const unsigned long featureCount = b.getFeatureCount();
+  const unsigned long distribCount = p.getDistribCount();
+  const weight_t* w = p.getWeightVect();
+  llkVect.setSize(featureCount);
+  lk_t* llk = llkVect.getArray();
+
+  DoubleVector zMatr(2*p.getStride()*FEATURE_TILE_SIZE,
+                     2*p.getStride()*FEATURE_TILE_SIZE);
+  zMatr.setAllValues(0.0);
+  DoubleVector logLkMatr(distribCount*FEATURE_TILE_SIZE,
+                         distribCount*FEATURE_TILE_SIZE);
+
+  for (unsigned long t=0; t<featureCount; t+=FEATURE_TILE_SIZE)
+  {
+    unsigned long n = featureCount-t;
+    if (n > FEATURE_TILE_SIZE)
+      n = FEATURE_TILE_SIZE;
+    computeLogLKMatrix(p, b.getFeatureVector(t), n, zMatr.getArray(),
+                       logLkMatr.getArray());
+    const lk_t* l = logLkMatr.getArray();
+    for (unsigned long i=0; i<n; i++, l+=distribCount)
+    {
+      unsigned long c;
+      lk_t max = 0.0, sum = 0.0;
+      for (c=0; c<distribCount; c++)
+        if (w[c] > 0.0 && (sum == 0.0 || l[c] > max))
+        {
+          max = l[c];
+          sum = 1.0;
+        }
+      if (sum != 0.0)
+      {
+        sum = 0.0;
+        for (c=0; c<distribCount; c++)
+          if (w[c] > 0.0)
+            sum += exp(l[c]-max);
+      }
+      llk[t+i] = computeLLK(max, sum);
+    }
+  }
+}
+//-------------------------------------------------------------------------
 lk_t S::computeLLK(const K&, const Mixture& m) const
 {
   const weight_t* weightVect  = m.getTabWeight().getArray();
@@ -195,6 +564,19 @@ lk_t S::computeLLK(lk_t lk) const // private
   return lk;
 }
 //-------------------------------------------------------------------------
+// returns log(sum*exp(max)) (see addLogLK())
+lk_t S::computeLLK(lk_t max, lk_t sum) const // private
+{
+  if (sum <= 0.0)
+    return _minLLK;
+  lk_t llk = max + log(sum);
+  if (ISNAN(llk) || llk < _minLLK)
+    llk = _minLLK;
+  else if (llk > _maxLLK)
+    llk = _maxLLK;
+  return llk;
+}
+//-------------------------------------------------------------------------
 lk_t S::computeLLK(const K&, const Mixture& m, const Feature& f,
                    const TopDistribsAction& a)
 {
@@ -233,16 +615,29 @@ lk_t S::computeLLK(const K&, const Mixture& m, const Feature& f,
     return computeLLK(lk);
   }
   // a == DETERMINE_TOP_DISTRIBS
-  lkVect.setSize(distribCount);
-  LKVector::type* v = lkVect.getArray();
+  const MixtureGDTree* pTree = getTopDistribsTree(m);
   lkVect.topDistribsCount = nTop;
-
-  for (c=0; c<distribCount; c++)
+  if (pTree != NULL)
+  {
+    unsigned long computedCount = pTree->computeTopDistribs(f,
+        _config.getParam_topDistribsTreeBeam(), nTop, lkVect,
+        _clusterLKVect);
+    LKVector::type* v = lkVect.getArray();
+    for (i=0; i<computedCount; i++)
+      lk += v[i].lk;
+  }
+  else
   {
-    v[c].idx = c;
-    lk += (v[c].lk = w[c] * d[c]->computeLK(f));
+    lkVect.setSize(distribCount);
+    LKVector::type* v = lkVect.getArray();
+    for (c=0; c<distribCount; c++)
+    {
+      v[c].idx = c;
+      lk += (v[c].lk = w[c] * d[c]->computeLK(f));
+    }
+    lkVect.descendingPartialSort(nTop);
   }
-  lkVect.descendingSort();
+  LKVector::type* v = lkVect.getArray();
   //
   if (_config.getParam_computeLLKWithTopDistribs() == true) // COMPLETE
   {
@@ -261,6 +656,125 @@ lk_t S::computeLLK(const K&, const Mixture& m, const Feature& f,
   return computeLLK(lk);
 }
 //-------------------------------------------------------------------------
+lk_t S::computeMeanLLK(const Mixture& world, const MixtureGDPackedSet& s,
+                       const FeatureBlock& b, DoubleVector& llkVect)
+{
+  const unsigned long vectSize = b.getVectSize();
+  const unsigned long featureCount = b.getFeatureCount();
+  const unsigned long mixtureCount = s.getMixtureCount();
+  const unsigned long distribCount = world.getDistribCount();
+  if (!s.isUpToDate())
+    throw Exception("compiled target mixtures are out of date :"
+                    " call update()", __FILE__, __LINE__);
+  if (mixtureCount != 0 && (s.getVectSize() != vectSize ||
+                            s.getDistribCount() != distribCount))
+    throw Exception("target mixtures (distribCount = "
+        + String::valueOf(s.getDistribCount()) + ", vectSize = "
+        + String::valueOf(s.getVectSize()) + ") do not match the world ("
+        + String::valueOf(distribCount) + ") and the features ("
+        + String::valueOf(vectSize) + ")", __FILE__, __LINE__);
+  const unsigned long stride = s.getStride();
+  const real_t* param = s.getParamMatrix();
+  const weight_t* w = s.getWeightVect();
+  const real_t* cst = s.getCstVect();
+  const bool complete = _config.getParam_computeLLKWithTopDistribs();
+  unsigned long nTop = _config.getParam_topDistribsCount();
+  if (nTop > distribCount)
+    nTop = distribCount;
+  const LKVector& lkVect = _topDistribsVect;
+  Feature f(vectSize);
+  lk_t worldLLK = 0.0;
+  unsigned long t, i, j;
+
+  llkVect.setSize(mixtureCount);
+  llkVect.setAllValues(0.0);
+  for (t=0; t<featureCount; t++)
+  {
+    b.getFeature(f, t);
+    worldLLK += computeLLK(K::k, world, f, DETERMINE_TOP_DISTRIBS);
+    const LKVector::type* v = lkVect.getArray();
+    const real_t* x = b.getFeatureVector(t);
+    for (i=0; i<mixtureCount; i++)
+    {
+      const unsigned long first = i*distribCount;
+      real_t sumTopDistribWeights = 0.0;
+      lk_t lk = 0.0;
+      for (j=0; j<nTop; j++)
+      {
+        const unsigned long k = first + v[j].idx;
+        const real_t* m = param + 2*k*stride;
+        lk_t l = cst[k] * exp(-0.5*SimdKernels::diagQuadForm(x, m,
+                                                  m+stride, vectSize));
+        if (ISNAN(l))
+          l = EPS_LK;
+        sumTopDistribWeights += w[k];
+        lk += w[k] * l;
+      }
+      if (complete)
+        lk += lkVect.sumNonTopDistribLK *
+            (1.0 - sumTopDistribWeights) / lkVect.sumNonTopDistribWeights;
+      else if (nTop != 0)
+        lk /= sumTopDistribWeights;
+      llkVect[i] += computeLLK(lk);
+    }
+  }
+  if (featureCount == 0)
+    return 0.0;
+  for (i=0; i<mixtureCount; i++)
+    llkVect[i] /= featureCount;
+  return worldLLK/featureCount;
+}
+//-------------------------------------------------------------------------
+const MixtureGDTree* S::getTopDistribsTree(const Mixture& m) // private
+{
+  if (!_config.existsParam_topDistribsTreeClusterCount ||
+      !_config.existsParam_topDistribsTreeBeam ||
+      m.getType() != DistribType_GD)
+    return NULL;
+  const MixtureGD& mg = static_cast<const MixtureGD&>(m);
+  // A tree keeps a pointer on its mixture, which may have been deleted
+  // since. The address is not enough to find the tree : the identifier
+  // and the number of distributions must match too, and update() checks
+  // the stamps, which are always newer for a new mixture.
+  for (unsigned long i=0; i<_topDistribsTreeVect.size(); i++)
+  {
+    MixtureGDTree& t = _topDistribsTreeVect.getObject(i);
+    if (&t.getMixture() == &mg && t.getMixtureId() == mg.getId() &&
+        t.getDistribCount() == mg.getDistribCount())
+    {
+      t.update();
+      return &t;
+    }
+  }
+  deleteDeadTopDistribsTrees(mg);
+  MixtureGDTree* pTree = new (std::nothrow) MixtureGDTree(mg,
+                         _config.getParam_topDistribsTreeClusterCount());
+  assertMemoryIsAllocated(pTree, __FILE__, __LINE__);
+  _topDistribsTreeVect.addObject(*pTree);
+  return pTree;
+}
+//-------------------------------------------------------------------------
+void S::deleteDeadTopDistribsTrees(const Mixture& m) // private
+{
+  // The mixture of a tree is not used here, it may not exist anymore.
+  // A tree is deleted if its mixture has been replaced by m (same address
+  // or same identifier) or is not inside the mixture server anymore.
+  unsigned long i = _topDistribsTreeVect.size();
+  while (i-- > 0)
+  {
+    const MixtureGDTree& t = _topDistribsTreeVect.getObject(i);
+    const Mixture* pMixture = &t.getMixture();
+    bool dead = pMixture == &m || t.getMixtureId() == m.getId();
+    if (!dead && _pMixtureServer != NULL)
+    {
+      const long j = _pMixtureServer->getMixtureIndex(t.getMixtureId());
+      dead = j < 0 || &_pMixtureServer->getMixture(j) != pMixture;
+    }
+    if (dead)
+      delete &_topDistribsTreeVect.removeObject(i);
+  }
+}
+//-------------------------------------------------------------------------
 lk_t S::computeLLK(const K&, const Mixture& m, const Feature& f,
                    const LKVector& lkVect)
 {
@@ -300,10 +814,24 @@ void S::computeAllDistribLK(const Feature& f)
   if (_pMixtureServer == NULL)
     throw Exception("No mixture server connected to this stat server"
         , __FILE__, __LINE__);
-  _distribLKVect.clear();
+  if (_pTaskPool == NULL)
+  {
+    _pTaskPool = new (std::nothrow) TaskPool(_config);
+    assertMemoryIsAllocated(_pTaskPool, __FILE__, __LINE__);
+    _ownTaskPool = true;
+  }
   unsigned long n = _pMixtureServer->getDistribCount();
-  for (unsigned long i=0; i<n; i++)
-    _distribLKVect.addValue(_pMixtureServer->getDistrib(i).computeLK(f));
+  _distribLKVect.setSize(n);
+  DistribLKTask t(*_pMixtureServer, f, _distribLKVect.getArray());
+  _pTaskPool->parallelFor(0, n, DISTRIB_LK_GRAIN, t);
+}
+//-------------------------------------------------------------------------
+void S::setTaskPool(TaskPool& p)
+{
+  if (_ownTaskPool)
+    delete _pTaskPool;
+  _pTaskPool = &p;
+  _ownTaskPool = false;
 }
 //-------------------------------------------------------------------------
 void S::resetOcc(const Mixture& m) { getMixtureStat(m).resetOcc(); }
@@ -504,6 +1032,9 @@ S::~StatServer()
 {
   //_mixtureStatVect.deleteAllObjects();
   _viterbiAccumVect.deleteAllObjects();
+  _topDistribsTreeVect.deleteAllObjects();
+  if (_ownTaskPool)
+    delete _pTaskPool;
 }
 //-------------------------------------------------------------------------
 
@@ -0,0 +1,356 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+
+#if !defined(ALIZE_TaskPool_cpp)
+#define ALIZE_TaskPool_cpp
+
+#include <new>
+#if defined(THREAD)
+#include <pthread.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <sched.h>
+#endif
+#endif
+#include "TaskPool.h"
+#include "Config.h"
+#include "alizeString.h"
+#include "Exception.h"
+
+using namespace alize;
+typedef TaskPool P;
+
+#if defined(THREAD)
+namespace
+{
+  // part of the range owned by a thread. Padded to avoid false sharing.
+  struct Range
+  {
+    pthread_mutex_t mutex;
+    unsigned long   first;
+    unsigned long   last;
+    char            pad[64];
+  };
+  struct ThreadArgs
+  {
+    TaskPool*       pPool;
+    unsigned long   threadIdx;
+  };
+}
+//-------------------------------------------------------------------------
+struct TaskPool::State
+{
+  pthread_mutex_t mutex;      /*!< protects the fields below */
+  pthread_cond_t  startCond;
+  pthread_cond_t  doneCond;
+  pthread_mutex_t callMutex;  /*!< held during a parallel loop */
+  pthread_t*      threadVect;
+  ThreadArgs*     argsVect;
+  Range*          rangeVect;
+  Task*           pTask;
+  unsigned long   grain;
+  unsigned long   generation; /*!< incremented for each loop */
+  unsigned long   activeCount;
+  bool            failed;
+  bool            stop;
+};
+#endif
+//-------------------------------------------------------------------------
+TaskPool::Task::~Task() {}
+//-------------------------------------------------------------------------
+P::TaskPool(unsigned long threadCount, bool pinning)
+:Object(), _pState(NULL), _threadCount(threadCount), _pinning(pinning)
+{
+  if (threadCount == 0)
+    throw Exception("threadCount cannot be 0", __FILE__, __LINE__);
+  start();
+}
+//-------------------------------------------------------------------------
+P::TaskPool(const Config& c)
+:Object(), _pState(NULL),
+ _threadCount(c.existsParam_numThread ? c.getParam_numThread() : 1),
+ _pinning(c.existsParam_threadPinning && c.getParam_threadPinning())
+{ start(); }
+//-------------------------------------------------------------------------
+void P::start() // private
+{
+#if defined(THREAD)
+  if (_threadCount == 1)
+    return;
+  State* s = new (std::nothrow) State;
+  assertMemoryIsAllocated(s, __FILE__, __LINE__);
+  s->threadVect = new (std::nothrow) pthread_t[_threadCount];
+  assertMemoryIsAllocated(s->threadVect, __FILE__, __LINE__);
+  s->argsVect = new (std::nothrow) ThreadArgs[_threadCount];
+  assertMemoryIsAllocated(s->argsVect, __FILE__, __LINE__);
+  s->rangeVect = new (std::nothrow) Range[_threadCount];
+  assertMemoryIsAllocated(s->rangeVect, __FILE__, __LINE__);
+  pthread_mutex_init(&s->mutex, NULL);
+  pthread_cond_init(&s->startCond, NULL);
+  pthread_cond_init(&s->doneCond, NULL);
+  pthread_mutex_init(&s->callMutex, NULL);
+  s->pTask = NULL;
+  s->grain = 1;
+  s->generation = 0;
+  s->activeCount = 0;
+  s->failed = false;
+  s->stop = false;
+  for (unsigned long i=0; i<_threadCount; i++)
+  {
+    pthread_mutex_init(&s->rangeVect[i].mutex, NULL);
+    s->rangeVect[i].first = s->rangeVect[i].last = 0;
+    s->argsVect[i].pPool = this;
+    s->argsVect[i].threadIdx = i;
+  }
+  _pState = s;
+#if defined(__linux__)
+  const long cpuCount = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+  // thread 0 is the thread calling parallelFor(). It is not pinned.
+  unsigned long n = 1;
+  for (; n<_threadCount; n++)
+  {
+    if (pthread_create(&s->threadVect[n], NULL, threadMain,
+                       &s->argsVect[n]) != 0)
+      break;
+#if defined(__linux__)
+    if (_pinning && cpuCount > 0)
+    {
+      cpu_set_t set;
+      CPU_ZERO(&set);
+      CPU_SET(n % cpuCount, &set);
+      pthread_setaffinity_np(s->threadVect[n], sizeof(set), &set);
+    }
+#endif
+  }
+  // less threads if the system refuses to create them : the ranges of the
+  // missing threads are never used
+  for (unsigned long i=n; i<_threadCount; i++)
+    pthread_mutex_destroy(&s->rangeVect[i].mutex);
+  _threadCount = n;
+#else
+  _threadCount = 1;
+#endif
+}
+//-------------------------------------------------------------------------
+void* P::threadMain(void* p) // private
+{
+#if defined(THREAD)
+  const ThreadArgs& a = *static_cast<ThreadArgs*>(p);
+  State& s = *a.pPool->_pState;
+  unsigned long generation = 0;
+  pthread_mutex_lock(&s.mutex);
+  while (true)
+  {
+    while (!s.stop && s.generation == generation)
+      pthread_cond_wait(&s.startCond, &s.mutex);
+    if (s.stop)
+      break;
+    generation = s.generation;
+    pthread_mutex_unlock(&s.mutex);
+    a.pPool->work(a.threadIdx);
+    pthread_mutex_lock(&s.mutex);
+    if (--s.activeCount == 0)
+      pthread_cond_signal(&s.doneCond);
+  }
+  pthread_mutex_unlock(&s.mutex);
+#else
+  (void)p;
+#endif
+  return NULL;
+}
+//-------------------------------------------------------------------------
+void P::work(unsigned long threadIdx) // private
+{
+#if defined(THREAD)
+  State& s = *_pState;
+  Range& own = s.rangeVect[threadIdx];
+  unsigned long first, last;
+  while (true)
+  {
+    // next chunk of the own range
+    pthread_mutex_lock(&own.mutex);
+    if (own.first < own.last)
+    {
+      first = own.first;
+      last = own.last - first > s.grain ? first + s.grain : own.last;
+      own.first = last;
+      pthread_mutex_unlock(&own.mutex);
+      try { s.pTask->run(first, last, threadIdx); }
+      catch (...)
+      {
+        pthread_mutex_lock(&s.mutex);
+        s.failed = true;
+        pthread_mutex_unlock(&s.mutex);
+      }
+      continue;
+    }
+    pthread_mutex_unlock(&own.mutex);
+    // steals the second half of the range of another thread
+    bool found = false;
+    for (unsigned long i=1; !found && i<_threadCount; i++)
+    {
+      Range& r = s.rangeVect[(threadIdx+i)%_threadCount];
+      pthread_mutex_lock(&r.mutex);
+      if (r.first < r.last)
+      {
+        const unsigned long n = r.last - r.first;
+        first = n > s.grain ? r.last - n/2 : r.first;
+        last = r.last;
+        r.last = first;
+        found = true;
+      }
+      pthread_mutex_unlock(&r.mutex);
+    }
+    if (!found)
+      return; // all the ranges are empty
+    pthread_mutex_lock(&own.mutex);
+    own.first = first;
+    own.last = last;
+    pthread_mutex_unlock(&own.mutex);
+  }
+#else
+  (void)threadIdx;
+#endif
+}
+//-------------------------------------------------------------------------
+void P::parallelFor(unsigned long first, unsigned long last,
+                    unsigned long grain, Task& t)
+{
+  if (last <= first)
+    return;
+  if (grain == 0)
+    grain = 1;
+#if defined(THREAD)
+  if (_pState != NULL && last-first > grain &&
+      pthread_mutex_trylock(&_pState->callMutex) == 0)
+  {
+    State& s = *_pState;
+    const unsigned long n = last - first;
+    for (unsigned long i=0; i<_threadCount; i++)
+    {
+      s.rangeVect[i].first = first + (n/_threadCount)*i
+                           + (i < n%_threadCount ? i : n%_threadCount);
+      s.rangeVect[i].last = s.rangeVect[i].first + n/_threadCount
+                          + (i < n%_threadCount ? 1 : 0);
+    }
+    pthread_mutex_lock(&s.mutex);
+    s.pTask = &t;
+    s.grain = grain;
+    s.failed = false;
+    s.activeCount = _threadCount-1;
+    s.generation++;
+    pthread_cond_broadcast(&s.startCond);
+    pthread_mutex_unlock(&s.mutex);
+
+    work(0);
+
+    pthread_mutex_lock(&s.mutex);
+    while (s.activeCount != 0)
+      pthread_cond_wait(&s.doneCond, &s.mutex);
+    const bool failed = s.failed;
+    s.pTask = NULL;
+    pthread_mutex_unlock(&s.mutex);
+    pthread_mutex_unlock(&s.callMutex);
+    if (failed)
+      throw Exception("a task has failed", __FILE__, __LINE__);
+    return;
+  }
+#endif
+  // sequential loop
+  for (unsigned long i=first; i<last; i+=grain)
+    t.run(i, last-i > grain ? i+grain : last, 0);
+}
+//-------------------------------------------------------------------------
+unsigned long P::getThreadCount() const { return _threadCount; }
+//-------------------------------------------------------------------------
+bool P::isPinned() const { return _pinning && _threadCount > 1; }
+//-------------------------------------------------------------------------
+String P::getClassName() const { return "TaskPool"; }
+//-------------------------------------------------------------------------
+String P::toString() const
+{
+  return Object::toString()
+    + "\n  threadCount = " + String::valueOf(_threadCount)
+    + "\n  pinning     = " + String::valueOf(isPinned());
+}
+//-------------------------------------------------------------------------
+P::~TaskPool()
+{
+#if defined(THREAD)
+  if (_pState == NULL)
+    return;
+  State* s = _pState;
+  pthread_mutex_lock(&s->mutex);
+  s->stop = true;
+  pthread_cond_broadcast(&s->startCond);
+  pthread_mutex_unlock(&s->mutex);
+  for (unsigned long i=1; i<_threadCount; i++)
+    pthread_join(s->threadVect[i], NULL);
+  for (unsigned long i=0; i<_threadCount; i++)
+    pthread_mutex_destroy(&s->rangeVect[i].mutex);
+  pthread_mutex_destroy(&s->mutex);
+  pthread_cond_destroy(&s->startCond);
+  pthread_cond_destroy(&s->doneCond);
+  pthread_mutex_destroy(&s->callMutex);
+  delete [] s->rangeVect;
+  delete [] s->argsVect;
+  delete [] s->threadVect;
+  delete s;
+#endif
+}
+//-------------------------------------------------------------------------
+
+#endif // !defined(ALIZE_TaskPool_cpp)
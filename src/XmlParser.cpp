@@ -55,55 +55,80 @@
 #if !defined(ALIZE_XmlParser_cpp)
 #define ALIZE_XmlParser_cpp
 
+#include <new>
+#include <cstring>
 #include "XmlParser.h"
-#include "MixtureGD.h"
-#include "MixtureGF.h"
+#include "FileReader.h"
+#include "Exception.h"
 
 // see http://babel.alis.com/web_ml/xml/REC-xml.fr.html#NT-XMLDecl
 
 using namespace alize;
 
+static const unsigned long XML_BUFFER_SIZE = 65536;
+
 //-------------------------------------------------------------------------
 XmlParser::XmlParser()
-:Object() {}
+:Object(), _pXmlReader(NULL), _buffer(NULL), _bufferPos(0), _bufferEnd(0),
+ _line(1), _pathArray(NULL), _pathLength(0), _pathCapacity(0),
+ _valueArray(NULL), _valueLength(0), _valueCapacity(0) {}
 //-------------------------------------------------------------------------
-void XmlParser::parse()
+void XmlParser::parse(FileReader& r)
 {
+  _pXmlReader = &r;
+  if (_buffer == NULL)
+  {
+    _buffer = new (std::nothrow) char[XML_BUFFER_SIZE];
+    assertMemoryIsAllocated(_buffer, __FILE__, __LINE__);
+  }
+  _bufferPos = _bufferEnd = 0;
+  _line = 1;
+  _pathLength = 0;
+  _valueLength = 0;
+
   // lecture 1er et seul element
-  test(readNextChar() == "<", ": first character must be '<'");
-  parseElement("", readOneChar());
+  test(readNextChar() == '<', ": first character must be '<'");
+  parseElement(readOneChar());
 }
 //-------------------------------------------------------------------------
-void XmlParser::parseElement(String path, String s)
+unsigned long XmlParser::getLine() const { return _line; }
+//-------------------------------------------------------------------------
+void XmlParser::parseElement(char c) // private
 {
-  String tag, value;
+  const unsigned long pathLength = _pathLength;
+  const unsigned long valueStart = _valueLength;
 
   // read the opening tag
-  test(s != ">" && s != "<" && s != "\"" && !isASeparator(s), "");
-  while (s != "/" && s != ">" && !isASeparator(s))
+  test(c != '>' && c != '<' && c != '"' && !isASeparator(c), "");
+  pushPathChar('<');
+  const unsigned long tagStart = _pathLength;
+  while (c != '/' && c != '>' && !isASeparator(c))
   {
-    tag += s;
-    s = readOneChar();
+    pushPathChar(c);
+    c = readOneChar();
   }
-  eventOpeningElement(path += "<" + tag + ">");
+  const unsigned long tagEnd = _pathLength;
+  pushPathChar('>');
+  eventOpeningElement(currentPath());
 
-  if (isASeparator(s))
-    s = readNextChar();
+  if (isASeparator(c))
+    c = readNextChar();
 
   // read attributes
 
-  while ( s != "/" && s != ">")
+  while (c != '/' && c != '>')
   {
-    parseAttribute(path, s);
-    s = readNextChar();
+    parseAttribute(c);
+    c = readNextChar();
   }
 
   // fin element simple
 
-  if (s == "/")
+  if (c == '/')
   {
-    test(readOneChar() == ">", ": character '>' expected after '/'");
-    eventClosingElement(path, value);
+    test(readOneChar() == '>', ": character '>' expected after '/'");
+    eventClosingElement(currentPath(), currentValue(valueStart));
+    _pathLength = pathLength;
     return; // fin element simple
   }
 
@@ -111,79 +136,211 @@ void XmlParser::parseElement(String path, String s)
 
   while (true)
   {
-    while ( (s = readOneChar()) != "<")
-    {
-      if (s != "\r" && s != "\t" && s != "\n")
-        value += s;
-    }
-    s = readOneChar();
+    readText();
+    c = readOneChar();
 
     // closing tag
 
-    if (s == "/")
+    if (c == '/')
     {
-      s  = readOneChar();
-      test(s != ">", ": a tag cannot be empty");
-      String closingElement; // lecture balise de fermeture
-      while (s != ">")
+      c = readOneChar();
+      test(c != '>', ": a tag cannot be empty");
+      // the closing tag is read on the top of the value stack
+      const unsigned long closingStart = _valueLength;
+      while (c != '>')
       {
-        test(s != "/" && s != "\"" && s != "<" && !isASeparator(s),
+        test(c != '/' && c != '"' && c != '<' && !isASeparator(c),
           ": the tag contains an invalid character");
-        closingElement += s;
-        s  = readOneChar();
+        pushValueChar(c);
+        c = readOneChar();
+      }
+      const unsigned long closingLength = _valueLength-closingStart;
+      if (closingLength != tagEnd-tagStart || memcmp(_pathArray+tagStart,
+                        _valueArray+closingStart, closingLength) != 0)
+      {
+        reserve(_valueArray, _valueCapacity, _valueLength);
+        _valueArray[_valueLength] = 0;
+        _pathArray[tagEnd] = 0;
+        const String msg = " : End tag <"
+          + String(_valueArray+closingStart)
+          + "> does not match the start tag <"
+          + String(_pathArray+tagStart) + ">";
+        _pathArray[tagEnd] = '>';
+        eventError(msg);
       }
-      test(tag == closingElement, " : End tag <" + closingElement +
-         "> does not match the start tag <" + tag  + ">");
+      _valueLength = closingStart;
 
-      eventClosingElement(path, value);
+      eventClosingElement(currentPath(), currentValue(valueStart));
+      _pathLength = pathLength;
+      _valueLength = valueStart;
       return; // fin element compose
     }
-    parseElement(path, s);
+    parseElement(c);
   }
 }
 //-------------------------------------------------------------------------
-void XmlParser::parseAttribute(String path, String s)
+void XmlParser::parseAttribute(char c) // private
 {
-  String attribute, value;
-  test(s != "\"" && s != "<" && s != "=", "");
-  while (s != "=" && !isASeparator(s))
+  const unsigned long pathLength = _pathLength;
+  const unsigned long valueStart = _valueLength;
+
+  test(c != '"' && c != '<' && c != '=', "");
+  pushPathChar('<');
+  while (c != '=' && !isASeparator(c))
   {
-    attribute += s;
-    s = readOneChar();
-    test(s != "/" && s != ">" && s != "<" && s != "\"" && s != "'",
+    pushPathChar(c);
+    c = readOneChar();
+    test(c != '/' && c != '>' && c != '<' && c != '"' && c != '\'',
               ": an attribute contain an invalid character");
   }
-  eventOpeningElement(path += "<" + attribute + ">");
-  if (isASeparator(s))
-    test(readNextChar() == "=",
+  pushPathChar('>');
+  eventOpeningElement(currentPath());
+  if (isASeparator(c))
+    test(readNextChar() == '=',
        ": Missing equals sign between attribute and attribute value");
-  String quote = readNextChar();
-  test(quote == "\"" || quote == "'", String(": a string literal was")
+  const char quote = readNextChar();
+  if (quote != '"' && quote != '\'')
+    eventError(String(": a string literal was")
           + "expected, but no opening quote character was found");
-  while ( (s = readOneChar()) != quote)
-    value += s;
-  eventClosingElement(path, value);
+  while ( (c = readOneChar()) != quote)
+    pushValueChar(c);
+  eventClosingElement(currentPath(), currentValue(valueStart));
+  _pathLength = pathLength;
+  _valueLength = valueStart;
+}
+//-------------------------------------------------------------------------
+// Appends the text of an element to the value until the next '<'. The
+// character '<' is read. Characters '\r', '\t' and '\n' are not kept.
+//-------------------------------------------------------------------------
+void XmlParser::readText() // private
+{
+  while (true)
+  {
+    if (_bufferPos == _bufferEnd)
+      fillBuffer();
+    const char* p = _buffer+_bufferPos;
+    const char* e = _buffer+_bufferEnd;
+    const char* lt = static_cast<const char*>(memchr(p, '<', e-p));
+    if (lt != NULL)
+      e = lt;
+    reserve(_valueArray, _valueCapacity, _valueLength+(e-p));
+    char* v = _valueArray+_valueLength;
+    for (; p<e; p++)
+    {
+      const char c = *p;
+      if (c == '\n')
+        _line++;
+      else if (c != '\r' && c != '\t' && c != 0)
+        *v++ = c;
+    }
+    _valueLength = v-_valueArray;
+    if (lt != NULL)
+    {
+      _bufferPos = lt+1-_buffer;
+      return;
+    }
+    _bufferPos = _bufferEnd;
+  }
+}
+//-------------------------------------------------------------------------
+char XmlParser::readOneChar() // private
+{
+  if (_bufferPos == _bufferEnd)
+    fillBuffer();
+  const char c = _buffer[_bufferPos++];
+  if (c == '\n')
+    _line++;
+  return c;
 }
 //-------------------------------------------------------------------------
 // Return the next character of the file that is not a separator character
 //-------------------------------------------------------------------------
-const String& XmlParser::readNextChar()
+char XmlParser::readNextChar() // private
 {
   while(true) 
   {
-    const String& s = readOneChar();
-    if (!isASeparator(s))
-      return s;
+    const char c = readOneChar();
+    if (!isASeparator(c))
+      return c;
   }
-  return readNextChar(); // never used
 }
 //-------------------------------------------------------------------------
-bool XmlParser::isASeparator(String s) const
-{ return s == " " || s == "\n" || s == "\t" ||s == "\r"; }
+void XmlParser::fillBuffer() // private
+{
+  assert(_pXmlReader != NULL);
+  _bufferPos = 0;
+  _bufferEnd = _pXmlReader->readSomeBytes(_buffer, XML_BUFFER_SIZE);
+  if (_bufferEnd == 0)
+    throw EOFException("", __FILE__, __LINE__,
+                       _pXmlReader->getFullFileName());
+}
+//-------------------------------------------------------------------------
+// A null character has always been read as an empty string : it is not
+// stored in the path or in the value
+//-------------------------------------------------------------------------
+void XmlParser::pushPathChar(char c) // private
+{
+  if (c == 0)
+    return;
+  reserve(_pathArray, _pathCapacity, _pathLength+1);
+  _pathArray[_pathLength++] = c;
+}
+//-------------------------------------------------------------------------
+void XmlParser::pushValueChar(char c) // private
+{
+  if (c == 0)
+    return;
+  reserve(_valueArray, _valueCapacity, _valueLength+1);
+  _valueArray[_valueLength++] = c;
+}
+//-------------------------------------------------------------------------
+const String& XmlParser::currentPath() // private
+{
+  reserve(_pathArray, _pathCapacity, _pathLength);
+  _pathArray[_pathLength] = 0;
+  _path = _pathArray;
+  return _path;
+}
 //-------------------------------------------------------------------------
-void XmlParser::test(bool v, const String& msg) { if (!v) eventError(msg); }
+const String& XmlParser::currentValue(unsigned long start) // private
+{
+  reserve(_valueArray, _valueCapacity, _valueLength);
+  _valueArray[_valueLength] = 0;
+  _value = _valueArray+start;
+  return _value;
+}
+//-------------------------------------------------------------------------
+// Makes room for 'length' characters and a final null character
+//-------------------------------------------------------------------------
+void XmlParser::reserve(char*& array, unsigned long& capacity,
+                        unsigned long length) // private static
+{
+  if (length < capacity)
+    return;
+  const unsigned long newCapacity = 2*length+64;
+  char* p = new (std::nothrow) char[newCapacity];
+  assertMemoryIsAllocated(p, __FILE__, __LINE__);
+  if (array != NULL)
+  {
+    memcpy(p, array, capacity);
+    delete [] array;
+  }
+  array = p;
+  capacity = newCapacity;
+}
+//-------------------------------------------------------------------------
+bool XmlParser::isASeparator(char c) const // private
+{ return c == ' ' || c == '\n' || c == '\t' || c == '\r'; }
 //-------------------------------------------------------------------------
-XmlParser::~XmlParser() {}
+void XmlParser::test(bool v, const char* msg) // private
+{ if (!v) eventError(msg); }
+//-------------------------------------------------------------------------
+XmlParser::~XmlParser()
+{
+  delete [] _buffer;
+  delete [] _pathArray;
+  delete [] _valueArray;
+}
 //-------------------------------------------------------------------------
 
 #endif // !defined(ALIZE_XmlParser_cpp)
@@ -60,6 +60,9 @@
 #endif
 
 #include <new>
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
 #include <cstring>
 #include <iostream>
 #include <sstream>
@@ -70,6 +73,88 @@
 using namespace alize;
 typedef String S;
 
+// The conversions below first try strtod()/strtol() on the characters that
+// std::istream would read (spaces, sign, digits, point, exponent). When
+// this fast path cannot guarantee the same result as std::istream (other
+// syntax, overflow, locale with another decimal point...), the string is
+// read with std::istringstream as before.
+
+//-------------------------------------------------------------------------
+static bool isSpaceChar(char c)
+{
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v'
+      || c == '\f';
+}
+//-------------------------------------------------------------------------
+static bool isDigitChar(char c) { return c >= '0' && c <= '9'; }
+//-------------------------------------------------------------------------
+static bool fastToDouble(const char* c, double& v)
+{
+  while (isSpaceChar(*c))
+    c++;
+  const char* p = c;
+  bool digits = false;
+  if (*p == '+' || *p == '-')
+    p++;
+  for (; isDigitChar(*p); p++)
+    digits = true;
+  if (*p == '.')
+    for (p++; isDigitChar(*p); p++)
+      digits = true;
+  if (!digits)
+    return false;
+  if (*p == 'e' || *p == 'E')
+  {
+    p++;
+    if (*p == '+' || *p == '-')
+      p++;
+    if (!isDigitChar(*p))
+      return false;
+    while (isDigitChar(*p))
+      p++;
+  }
+  char* end;
+  v = strtod(c, &end);
+  return end == p && v != HUGE_VAL && v != -HUGE_VAL;
+}
+//-------------------------------------------------------------------------
+static const char* scanInteger(const char*& c, bool isSigned)
+{
+  // moves c after the spaces and returns the end of the digits or NULL
+  while (isSpaceChar(*c))
+    c++;
+  const char* p = c;
+  if (*p == '+' || (isSigned && *p == '-'))
+    p++;
+  if (!isDigitChar(*p))
+    return NULL;
+  while (isDigitChar(*p))
+    p++;
+  return p;
+}
+//-------------------------------------------------------------------------
+static bool fastToLong(const char* c, long& v)
+{
+  const char* p = scanInteger(c, true);
+  if (p == NULL)
+    return false;
+  char* end;
+  errno = 0;
+  v = strtol(c, &end, 10);
+  return end == p && errno != ERANGE;
+}
+//-------------------------------------------------------------------------
+static bool fastToULong(const char* c, unsigned long& v)
+{
+  const char* p = scanInteger(c, false);
+  if (p == NULL)
+    return false;
+  char* end;
+  errno = 0;
+  v = strtoul(c, &end, 10);
+  return end == p && errno != ERANGE;
+}
+
 //-------------------------------------------------------------------------
 S::String(const char* c)
 :Object()
@@ -132,6 +217,8 @@ double S::toDouble() const
 {
   // return atof(_string);
   double v;
+  if (fastToDouble(_string, v))
+    return v;
   std::istringstream stream(_string);
   stream >> v;
   if (stream.fail())
@@ -154,6 +241,8 @@ bool S::toBool() const
 long S::toLong() const
 {
   long v;
+  if (fastToLong(_string, v))
+    return v;
   std::istringstream stream(_string);
   stream >> v;
   if (stream.fail())
@@ -165,6 +254,8 @@ long S::toLong() const
 unsigned long S::toULong() const
 {
   unsigned long v;
+  if (fastToULong(_string, v))
+    return v;
   std::istringstream stream(_string);
   stream >> v;
   if (stream.fail())
@@ -320,6 +411,14 @@ bool S::endsWith(const String& s) const
   
 }
 //-------------------------------------------------------------------------
+bool S::endsWith(const char* s) const
+{
+  const unsigned long length = (unsigned long)strlen(s);
+  if (_length < length)
+    return false;
+  return memcmp(_string+(_length - length), s, length) == 0;
+}
+//-------------------------------------------------------------------------
 bool S::beginsWith(const String& s) const
                      
 {